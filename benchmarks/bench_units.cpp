@@ -0,0 +1,955 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains the benchmarks of the via::units types.
+///
+/// Every unit benchmark runs the same loop as a raw floating point baseline,
+/// e.g. `Feet<double>(Metres)` is compared with dividing `double` values, so
+/// the `baseline_ratio` shows the overhead of the unit types.
+//////////////////////////////////////////////////////////////////////////////
+#include "benchmark.hpp"
+#include "via/units.hpp"
+#include "via/units/airspeed.hpp"
+#include "via/units/codec.hpp"
+#include "via/units/columnar.hpp"
+#include "via/units/geodesy.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::bench;
+
+namespace {
+/// The number of elements in each benchmark loop: small enough for the
+/// arrays to fit in the L1 or L2 cache.
+constexpr std::size_t N{4'096};
+
+/// Allocates page aligned arrays, so that the relative alignment of the
+/// input and output arrays is the same in every benchmark.
+template <typename T> struct PageAllocator {
+  using value_type = T;
+  static constexpr std::align_val_t alignment{4'096};
+
+  PageAllocator() = default;
+  template <typename U> PageAllocator(const PageAllocator<U> &) noexcept {}
+
+  auto allocate(const std::size_t n) -> T * {
+    return static_cast<T *>(::operator new(n * sizeof(T), alignment));
+  }
+  void deallocate(T *p, const std::size_t) noexcept {
+    ::operator delete(p, alignment);
+  }
+  friend auto operator==(const PageAllocator &, const PageAllocator &)
+      -> bool = default;
+};
+
+/// A benchmark array.
+template <typename T> using Array = std::vector<T, PageAllocator<T>>;
+
+/// The name of a floating point type.
+template <typename T> constexpr const char *type_name{"double"};
+template <> constexpr const char *type_name<float>{"float"};
+template <> constexpr const char *type_name<std::int16_t>{"int16_t"};
+template <> constexpr const char *type_name<std::int32_t>{"int32_t"};
+
+/// The name of a raw floating point benchmark.
+template <typename T> auto raw_name(const std::string &operation) {
+  return std::string(type_name<T>) + " " + operation;
+}
+
+/// The name of a unit benchmark.
+template <typename T>
+auto unit_name(const std::string &unit, const std::string &operation) {
+  return unit + "<" + type_name<T> + "> " + operation;
+}
+
+/// Random values in the range [1, 1000).
+template <typename T> auto random_values(const unsigned seed) {
+  std::mt19937 gen{seed};
+  std::uniform_real_distribution<T> dist{T(1), T(1'000)};
+  Array<T> values(N);
+  for (auto &v : values)
+    v = dist(gen);
+  return values;
+}
+
+/// Convert values to units.
+template <typename U, typename T>
+auto to_units(const Array<T> &values) -> Array<U> {
+  Array<U> units;
+  units.reserve(values.size());
+  for (const auto v : values)
+    units.emplace_back(v);
+  return units;
+}
+
+/// A benchmark of: out[i] = f(in[i]).
+template <typename In, typename Out, typename F>
+auto map_benchmark(std::string name, std::string baseline, Array<In> in,
+                   Array<Out> out, F f) -> Benchmark {
+  auto data{std::make_shared<std::pair<Array<In>, Array<Out>>>(
+      std::move(in), std::move(out))};
+  return {std::move(name), std::move(baseline), N, [data, f] {
+            auto &[in, out]{*data};
+            for (std::size_t i{0}; i < N; ++i)
+              out[i] = f(in[i]);
+            clobber_memory();
+          },
+          sizeof(In) + sizeof(Out)};
+}
+
+/// A benchmark of: out[i] = f(a[i], b[i]).
+template <typename In, typename Out, typename F>
+auto binary_benchmark(std::string name, std::string baseline,
+                      Array<In> a, Array<In> b,
+                      Array<Out> out, F f) -> Benchmark {
+  struct Data {
+    Array<In> a, b;
+    Array<Out> out;
+  };
+  auto data{std::make_shared<Data>(std::move(a), std::move(b), std::move(out))};
+  return {std::move(name), std::move(baseline), N, [data, f] {
+            for (std::size_t i{0}; i < N; ++i)
+              data->out[i] = f(data->a[i], data->b[i]);
+            clobber_memory();
+          },
+          2 * sizeof(In) + sizeof(Out)};
+}
+
+/// A benchmark of: f(out[i], in[i]), for compound assignment operators.
+template <typename In, typename F>
+auto update_benchmark(std::string name, std::string baseline,
+                      Array<In> in, F f) -> Benchmark {
+  auto data{std::make_shared<std::pair<Array<In>, Array<In>>>(
+      in, std::move(in))};
+  return {std::move(name), std::move(baseline), N, [data, f] {
+            auto &[in, out]{*data};
+            for (std::size_t i{0}; i < N; ++i)
+              f(out[i], in[i]);
+            clobber_memory();
+          },
+          3 * sizeof(In)};
+}
+
+/// A benchmark counting: f(a[i], b[i]), for comparison operators.
+template <typename In, typename F>
+auto count_benchmark(std::string name, std::string baseline,
+                     Array<In> a, Array<In> b, F f) -> Benchmark {
+  auto data{std::make_shared<std::pair<Array<In>, Array<In>>>(
+      std::move(a), std::move(b))};
+  return {std::move(name), std::move(baseline), N, [data, f] {
+            auto &[a, b]{*data};
+            std::size_t count{0};
+            for (std::size_t i{0}; i < N; ++i)
+              count += f(a[i], b[i]);
+            do_not_optimize(count);
+          },
+          2 * sizeof(In)};
+}
+
+/// Add the raw floating point baselines.
+template <typename T> void add_raw_benchmarks(Suite &suite) {
+  const auto a{random_values<T>(1)};
+  const auto b{random_values<T>(2)};
+  const Array<T> out(N);
+  constexpr auto k{non_si::METRES_PER_FOOT<T>};
+
+  suite.add(map_benchmark(raw_name<T>("copy"), "", a, out,
+                          [](const T v) { return v; }));
+  suite.add(map_benchmark(raw_name<T>("multiply"), "", a, out,
+                          [k](const T v) { return k * v; }));
+  suite.add(map_benchmark(raw_name<T>("divide"), "", a, out,
+                          [k](const T v) { return v / k; }));
+  suite.add(map_benchmark(raw_name<T>("negate"), "", a, out,
+                          [](const T v) { return T() - v; }));
+  suite.add(binary_benchmark(raw_name<T>("add"), "", a, b, out,
+                             [](const T x, const T y) { return x + y; }));
+  suite.add(binary_benchmark(raw_name<T>("subtract"), "", a, b, out,
+                             [](const T x, const T y) { return x - y; }));
+  suite.add(update_benchmark(raw_name<T>("add_assign"), "", a,
+                             [](T &x, const T y) { x += y; }));
+  suite.add(update_benchmark(raw_name<T>("subtract_assign"), "", a,
+                             [](T &x, const T y) { x -= y; }));
+  suite.add(count_benchmark(raw_name<T>("less"), "", a, b,
+                            [](const T x, const T y) { return x < y; }));
+}
+
+/// Add the benchmarks of a unit type's constructor, operators and
+/// comparisons.
+template <typename U, typename T>
+void add_unit_benchmarks(Suite &suite, const std::string &unit) {
+  const auto values{random_values<T>(1)};
+  const auto a{to_units<U>(values)};
+  const auto b{to_units<U>(random_values<T>(2))};
+
+  suite.add(map_benchmark(unit_name<T>(unit, "constructor"),
+                          raw_name<T>("copy"), values, a,
+                          [](const T v) { return U(v); }));
+  suite.add(count_benchmark(unit_name<T>(unit, "<=>"), raw_name<T>("less"), a,
+                            b, [](const U &x, const U &y) {
+                              return (x <=> y) < 0;
+                            }));
+
+  if constexpr (requires(U x) { x + x; }) {
+    suite.add(binary_benchmark(unit_name<T>(unit, "+"), raw_name<T>("add"), a,
+                               b, a,
+                               [](const U &x, const U &y) { return x + y; }));
+    suite.add(binary_benchmark(unit_name<T>(unit, "-"),
+                               raw_name<T>("subtract"), a, b, a,
+                               [](const U &x, const U &y) { return x - y; }));
+    suite.add(map_benchmark(unit_name<T>(unit, "unary -"),
+                            raw_name<T>("negate"), a, a,
+                            [](const U &x) { return -x; }));
+    suite.add(update_benchmark(unit_name<T>(unit, "+="),
+                               raw_name<T>("add_assign"), a,
+                               [](U &x, const U &y) { x += y; }));
+    suite.add(update_benchmark(unit_name<T>(unit, "-="),
+                               raw_name<T>("subtract_assign"), a,
+                               [](U &x, const U &y) { x -= y; }));
+  }
+}
+
+/// Add the benchmarks of the conversions between a non-SI unit and an
+/// SI unit.
+template <typename NonSi, typename Si, typename T, typename ToSi>
+void add_conversion_benchmarks(Suite &suite, const std::string &unit,
+                               const std::string &si_unit,
+                               const std::string &to_si, ToSi to_si_f) {
+  const auto non_si_values{to_units<NonSi>(random_values<T>(1))};
+  const auto si_values{to_units<Si>(random_values<T>(2))};
+
+  suite.add(map_benchmark(unit_name<T>(unit, "(" + si_unit + ")"),
+                          raw_name<T>("divide"), si_values, non_si_values,
+                          [](const Si &v) { return NonSi(v); }));
+  suite.add(map_benchmark(unit_name<T>(unit, to_si), raw_name<T>("multiply"),
+                          non_si_values, si_values, to_si_f));
+}
+
+/// Add the benchmarks of the fused conversions between non-SI units.
+template <typename T> void add_convert_benchmarks(Suite &suite) {
+  using non_si::Feet;
+  using non_si::NauticalMiles;
+  const auto feet{to_units<Feet<T>>(random_values<T>(1))};
+  const auto nautical_miles{to_units<NauticalMiles<T>>(random_values<T>(2))};
+
+  suite.add(map_benchmark(
+      unit_name<T>("Feet", "convert<NauticalMiles>"), raw_name<T>("multiply"),
+      feet, nautical_miles,
+      [](const Feet<T> &v) { return convert<NauticalMiles<T>>(v); }));
+  suite.add(map_benchmark(
+      unit_name<T>("NauticalMiles", "convert<Feet>"), raw_name<T>("multiply"),
+      nautical_miles, feet,
+      [](const NauticalMiles<T> &v) { return convert<Feet<T>>(v); }));
+}
+
+/// The number of altitude samples in each ISA benchmark loop.
+constexpr std::size_t ISA_SAMPLES{100'000'000};
+
+/// A benchmark of: out[i] = f(altitudes[i]) over ISA_SAMPLES altitudes,
+/// repeating an array of N random altitudes between sea level and 80 km.
+template <typename T, typename Out, typename F>
+auto isa_benchmark(std::string name, std::string baseline, F f) -> Benchmark {
+  std::mt19937 gen{1};
+  std::uniform_real_distribution<T> dist{T(), isa::MAXIMUM_ALTITUDE<T>.v()};
+  Array<si::Metres<T>> altitudes;
+  altitudes.reserve(N);
+  for (std::size_t i{0}; i < N; ++i)
+    altitudes.emplace_back(dist(gen));
+
+  auto data{std::make_shared<std::pair<Array<si::Metres<T>>, Array<Out>>>(
+      std::move(altitudes), Array<Out>(N))};
+  return {std::move(name), std::move(baseline), ISA_SAMPLES / N * N,
+          [data, f] {
+            auto &[in, out]{*data};
+            for (std::size_t j{0}; j < ISA_SAMPLES / N; ++j) {
+              for (std::size_t i{0}; i < N; ++i)
+                out[i] = f(in[i]);
+              clobber_memory();
+            }
+          }};
+}
+
+/// Add the benchmarks of the Exact and Fast ISA pressure and density.
+/// The Fast benchmarks use the Exact benchmarks as their baselines, so
+/// their `baseline_ratio` is the inverse of the speedup.
+template <typename T> void add_isa_benchmarks(Suite &suite) {
+  using si::KilogramsPerCubicMetre;
+  using si::Metres;
+  using si::Pascals;
+  const auto exact_pressure{unit_name<T>("Metres", "isa::pressure<Exact>")};
+  const auto exact_density{unit_name<T>("Metres", "isa::density<Exact>")};
+
+  suite.add(isa_benchmark<T, Pascals<T>>(
+      exact_pressure, "",
+      [](const Metres<T> &v) { return isa::pressure<isa::Exact>(v); }));
+  suite.add(isa_benchmark<T, Pascals<T>>(
+      unit_name<T>("Metres", "isa::pressure<Fast>"), exact_pressure,
+      [](const Metres<T> &v) { return isa::pressure<isa::Fast>(v); }));
+  suite.add(isa_benchmark<T, KilogramsPerCubicMetre<T>>(
+      exact_density, "",
+      [](const Metres<T> &v) { return isa::density<isa::Exact>(v); }));
+  suite.add(isa_benchmark<T, KilogramsPerCubicMetre<T>>(
+      unit_name<T>("Metres", "isa::density<Fast>"), exact_density,
+      [](const Metres<T> &v) { return isa::density<isa::Fast>(v); }));
+}
+
+/// Add the benchmarks of converting CAS to TAS at random altitudes up to
+/// 40,000 ft: the scalar and batch `airspeed::convert` functions, compared
+/// with the compressible flow equations evaluated with `std::pow`.
+template <typename T> void add_airspeed_benchmarks(Suite &suite) {
+  using airspeed::Cas;
+  using airspeed::Tas;
+  using non_si::Feet;
+  using non_si::Knots;
+  struct Data {
+    Array<Cas<Knots<T>>> cas;
+    Array<Feet<T>> altitudes;
+    Array<Tas<Knots<T>>> tas;
+  };
+  std::mt19937 gen{1};
+  std::uniform_real_distribution<T> speeds{T(100), T(300)};
+  std::uniform_real_distribution<T> heights{T(), T(40'000)};
+  auto data{std::make_shared<Data>()};
+  for (std::size_t i{0}; i < N; ++i) {
+    data->cas.emplace_back(Knots<T>(speeds(gen)));
+    data->altitudes.emplace_back(heights(gen));
+  }
+  data->tas.resize(N);
+
+  const auto baseline{unit_name<T>("Knots", "std::pow CAS to TAS")};
+  suite.add({baseline, "", N, [data] {
+               const T a0{airspeed::SEA_LEVEL_SPEED_OF_SOUND<T>.v()};
+               for (std::size_t i{0}; i < N; ++i) {
+                 const auto state{
+                     airspeed::atmosphere<isa::Fast>(data->altitudes[i])};
+                 const T x{data->cas[i].speed().to_si().v() / a0};
+                 const T q{std::pow(T(1) + T(0.2) * x * x, T(3.5)) - T(1)};
+                 const T mach{std::sqrt(
+                     T(5) * (std::pow(q / state.pressure_ratio + T(1),
+                                      T(2) / T(7)) -
+                             T(1)))};
+                 data->tas[i] = Tas<Knots<T>>(
+                     Knots<T>(si::MetresPerSecond<T>(mach *
+                                                     state.speed_of_sound)));
+               }
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("Knots", "convert CAS to TAS"), baseline, N, [data] {
+               for (std::size_t i{0}; i < N; ++i)
+                 data->tas[i] = airspeed::convert<Tas<Knots<T>>, isa::Fast>(
+                     data->cas[i], data->altitudes[i]);
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("Knots", "batch convert CAS to TAS"), baseline, N,
+             [data] {
+               airspeed::convert<Tas<Knots<T>>, isa::Fast>(
+                   std::span<const Cas<Knots<T>>>(data->cas),
+                   std::span<const Feet<T>>(data->altitudes),
+                   std::span<Tas<Knots<T>>>(data->tas));
+               clobber_memory();
+             }});
+}
+
+/// Parse a floating point value with the C library: strtof or strtod.
+template <typename T> auto strtot(const char *str, char **end) -> T {
+  if constexpr (std::same_as<T, float>)
+    return std::strtof(str, end);
+  else
+    return std::strtod(str, end);
+}
+
+/// Write values to a comma separated column of text, with a unit symbol.
+template <typename T>
+auto to_column(const Array<T> &values, const std::string &symbol) {
+  std::string text;
+  for (const auto v : values) {
+    std::array<char, TO_CHARS_MAX_SIZE> buffer;
+    const auto result{
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), v)};
+    text.append(buffer.data(), result.ptr);
+    text += symbol;
+    text += ',';
+  }
+  return text;
+}
+
+/// Add the benchmarks of parsing a column of text, compared with the C
+/// library parsing the same values without unit symbols.
+template <typename T> void add_parse_benchmarks(Suite &suite) {
+  const auto values{random_values<T>(1)};
+  const auto strtod_name{
+      raw_name<T>(std::same_as<T, float> ? "strtof" : "strtod")};
+
+  auto raw{std::make_shared<std::pair<std::string, Array<T>>>(
+      to_column(values, ""), Array<T>(N))};
+  suite.add({strtod_name, "", N, [raw] {
+               auto &[text, out]{*raw};
+               const char *p{text.c_str()};
+               for (std::size_t i{0}; i < N; ++i) {
+                 char *end{};
+                 out[i] = strtot<T>(p, &end);
+                 p = end + 1;
+               }
+               clobber_memory();
+             }});
+
+  using non_si::Feet;
+  auto data{std::make_shared<std::pair<std::string, Array<Feet<T>>>>(
+      to_column(values, "ft"), Array<Feet<T>>(N))};
+  suite.add({unit_name<T>("Feet", "parse_column"), strtod_name, N, [data] {
+               auto &[text, out]{*data};
+               const auto result{
+                   parse_column(text, std::span<Feet<T>>(out))};
+               do_not_optimize(result.count);
+               clobber_memory();
+             }});
+}
+
+/// Add the benchmarks of opening a columnar file and summing its values,
+/// compared with parsing the same values from a column of text.
+template <typename T> void add_columnar_benchmarks(Suite &suite) {
+  using non_si::Feet;
+  const auto feet{to_units<Feet<T>>(random_values<T>(1))};
+
+  // The file is removed when the benchmark is destroyed.
+  const auto path{std::filesystem::temp_directory_path() /
+                  (std::string("via_units_bench_") + type_name<T> + ".bin")};
+  std::shared_ptr<const std::filesystem::path> file(
+      new std::filesystem::path(path), [](const std::filesystem::path *p) {
+        std::filesystem::remove(*p);
+        delete p;
+      });
+  if (write_columns(path, NamedColumn<Feet<T>>{"altitude", feet}) !=
+      std::errc())
+    return;
+
+  suite.add({unit_name<T>("Feet", "MappedColumns open"),
+             unit_name<T>("Feet", "parse_column"), N, [file] {
+               const auto columns{MappedColumns<Feet<T>>::open(*file)};
+               do_not_optimize(sum(columns->template column<0>()));
+               clobber_memory();
+             }});
+}
+
+/// Add the benchmarks of encoding and decoding a smooth series of altitudes,
+/// compared with parsing the same number of values from a column of text.
+template <typename T> void add_codec_benchmarks(Suite &suite) {
+  using non_si::Feet;
+  Array<Feet<T>> feet;
+  feet.reserve(N);
+  for (std::size_t i{0}; i < N; ++i)
+    feet.emplace_back(T(1'000) + T(8.3) * static_cast<T>(i) +
+                      T(7) * std::sin(T(0.37) * static_cast<T>(i)));
+
+  auto data{std::make_shared<
+      std::pair<Array<Feet<T>>, std::vector<std::byte>>>(
+      std::move(feet), std::vector<std::byte>())};
+  if (encode(data->first, Feet<T>(1), data->second) != std::errc())
+    return;
+
+  const auto baseline{unit_name<T>("Feet", "parse_column")};
+  suite.add({unit_name<T>("Feet", "encode"), baseline, N, [data] {
+               auto &[in, bytes]{*data};
+               bytes.clear();
+               do_not_optimize(encode(in, Feet<T>(1), bytes));
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("Feet", "decode"), baseline, N, [data] {
+               auto &[out, bytes]{*data};
+               do_not_optimize(decode(std::span<const std::byte>(bytes),
+                                      std::span<Feet<T>>(out)));
+               clobber_memory();
+             }});
+}
+
+/// Add the benchmarks of evaluating `a + b - c` over Metres as an expression
+/// and with the batch kernels via a temporary array, compared with a hand
+/// written loop over raw floating point values.
+template <typename T> void add_expression_benchmarks(Suite &suite) {
+  using si::Metres;
+  struct Data {
+    Array<Metres<T>> a;
+    Array<Metres<T>> b;
+    Array<Metres<T>> c;
+    Array<Metres<T>> out;
+  };
+  auto data{std::make_shared<Data>()};
+  data->a = to_units<Metres<T>>(random_values<T>(1));
+  data->b = to_units<Metres<T>>(random_values<T>(2));
+  data->c = to_units<Metres<T>>(random_values<T>(3));
+  data->out.resize(N);
+
+  const auto baseline{raw_name<T>("a + b - c")};
+  suite.add({baseline, "", N, [data] {
+               const auto *a{reinterpret_cast<const T *>(data->a.data())};
+               const auto *b{reinterpret_cast<const T *>(data->b.data())};
+               const auto *c{reinterpret_cast<const T *>(data->c.data())};
+               auto *out{reinterpret_cast<T *>(data->out.data())};
+               for (std::size_t i{0}; i < N; ++i)
+                 out[i] = a[i] + b[i] - c[i];
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("Metres", "simd add, subtract"), baseline, N,
+             [data] {
+               const auto values{[](const Array<Metres<T>> &units) {
+                 return std::span<const T>(
+                     reinterpret_cast<const T *>(units.data()), units.size());
+               }};
+               Array<T> temporary(N);
+               simd::add(values(data->a), values(data->b),
+                         std::span<T>(temporary));
+               simd::subtract(std::span<const T>(temporary), values(data->c),
+                              std::span<T>(reinterpret_cast<T *>(
+                                               data->out.data()),
+                                           N));
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("Metres", "evaluate a + b - c"), baseline, N,
+             [data] {
+               evaluate(lazy(data->a) + lazy(data->b) - lazy(data->c),
+                        std::span<Metres<T>>(data->out));
+               clobber_memory();
+             }});
+}
+
+/// The number of positions from in the geodesy benchmarks.
+constexpr std::size_t FROM_POSITIONS{16};
+
+/// Add the benchmarks of the great circle distances between 16 positions and
+/// N / 16 positions, compared with the haversine formula with `std::sin`,
+/// `std::cos` and `std::asin`.
+template <typename T> void add_geodesy_benchmarks(Suite &suite) {
+  using geodesy::LatLong;
+  using non_si::NauticalMiles;
+  struct Data {
+    Array<LatLong<T>> from;
+    Array<LatLong<T>> to;
+    Array<NauticalMiles<T>> out;
+  };
+  std::mt19937 gen{1};
+  std::uniform_real_distribution<T> latitudes{T(-90), T(90)};
+  std::uniform_real_distribution<T> longitudes{T(-180), T(180)};
+  auto data{std::make_shared<Data>()};
+  for (std::size_t i{0}; i < FROM_POSITIONS; ++i)
+    data->from.push_back({latitudes(gen), longitudes(gen)});
+  for (std::size_t i{0}; i < N / FROM_POSITIONS; ++i)
+    data->to.push_back({latitudes(gen), longitudes(gen)});
+  data->out.resize(N);
+
+  const auto baseline{unit_name<T>("NauticalMiles", "std haversine")};
+  suite.add({baseline, "", N, [data] {
+               constexpr T k{std::numbers::pi_v<T> / 180};
+               const T radius{convert<NauticalMiles<T>>(
+                                  geodesy::EARTH_MEAN_RADIUS<T>)
+                                  .v()};
+               auto out{data->out.begin()};
+               for (const auto &a : data->from)
+                 for (const auto &b : data->to) {
+                   const T s1{std::sin((b.latitude - a.latitude) * k / 2)};
+                   const T s2{std::sin((b.longitude - a.longitude) * k / 2)};
+                   const T h{s1 * s1 + std::cos(a.latitude * k) *
+                                           std::cos(b.latitude * k) * s2 *
+                                           s2};
+                   *out++ = NauticalMiles<T>(
+                       2 * radius * std::asin(std::sqrt(std::min(h, T(1)))));
+                 }
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("NauticalMiles", "great_circle_distance"), baseline,
+             N, [data] {
+               auto out{data->out.begin()};
+               for (const auto &a : data->from)
+                 for (const auto &b : data->to)
+                   *out++ = convert<NauticalMiles<T>>(
+                       geodesy::great_circle_distance(a, b));
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("NauticalMiles", "great_circle_distance_matrix"),
+             baseline, N, [data] {
+               geodesy::great_circle_distance_matrix(
+                   std::span<const LatLong<T>>(data->from),
+                   std::span<const LatLong<T>>(data->to),
+                   std::span<NauticalMiles<T>>(data->out));
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("NauticalMiles", "ellipsoidal_distance"), baseline,
+             N, [data] {
+               auto out{data->out.begin()};
+               for (const auto &a : data->from)
+                 for (const auto &b : data->to)
+                   *out++ = convert<NauticalMiles<T>>(
+                       geodesy::ellipsoidal_distance(a, b));
+               clobber_memory();
+             }});
+}
+
+/// Add the benchmarks of stepping positions and speeds forward at constant
+/// accelerations, compared with the same loop over raw floating point values.
+template <typename T> void add_kinematics_benchmarks(Suite &suite) {
+  using non_si::Knots;
+  using non_si::NauticalMiles;
+  using si::MetresPerSecondSquared;
+  using si::Seconds;
+  struct Data {
+    Array<NauticalMiles<T>> positions;
+    Array<Knots<T>> speeds;
+    Array<MetresPerSecondSquared<T>> accelerations;
+  };
+  const auto values{random_values<T>(1)};
+  auto data{std::make_shared<Data>()};
+  for (std::size_t i{0}; i < N; ++i) {
+    data->positions.emplace_back(values[i]);
+    data->speeds.emplace_back(values[i]);
+    data->accelerations.emplace_back(values[i] / T(1'000));
+  }
+
+  const auto baseline{raw_name<T>("integrate")};
+  suite.add({baseline, "", N, [data] {
+               // The factors of a one second step in NauticalMiles and Knots.
+               const T speed_factor{T(1) / T(3'600)};
+               const T acceleration_factor{T(0.5) / T(1'852)};
+               const T speed_change_factor{T(3'600) / T(1'852)};
+               auto *p{reinterpret_cast<T *>(data->positions.data())};
+               auto *v{reinterpret_cast<T *>(data->speeds.data())};
+               const auto *a{
+                   reinterpret_cast<const T *>(data->accelerations.data())};
+               for (std::size_t i{0}; i < N; ++i) {
+                 p[i] += v[i] * speed_factor + a[i] * acceleration_factor;
+                 v[i] += a[i] * speed_change_factor;
+               }
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("NauticalMiles", "advance"), baseline, N, [data] {
+               const Seconds<T> time(1);
+               for (std::size_t i{0}; i < N; ++i) {
+                 data->positions[i] =
+                     kinematics::advance(data->positions[i], data->speeds[i],
+                                         data->accelerations[i], time);
+                 data->speeds[i] = kinematics::accelerate(
+                     data->speeds[i], data->accelerations[i], time);
+               }
+               clobber_memory();
+             }});
+  suite.add({unit_name<T>("NauticalMiles", "integrate"), baseline, N, [data] {
+               kinematics::integrate(
+                   std::span<NauticalMiles<T>>(data->positions),
+                   std::span<Knots<T>>(data->speeds),
+                   std::span<const MetresPerSecondSquared<T>>(
+                       data->accelerations),
+                   Seconds<T>(1));
+               clobber_memory();
+             }});
+}
+
+/// The number of rows of each flight in the column benchmarks.
+constexpr std::size_t FLIGHT_ROWS{64};
+
+/// Add the benchmarks of loading flights of rows of units into a `UnitTable`
+/// in a monotonic arena, compared with appending them to a `std::vector` of
+/// each unit.
+template <typename T> void add_column_benchmarks(Suite &suite) {
+  using non_si::Knots;
+  using si::Kelvin;
+  using si::Metres;
+  const auto values{random_values<T>(1)};
+
+  const auto vector_name{raw_name<T>("std::vector push_back")};
+  suite.add({vector_name, "", N, [values] {
+               for (std::size_t i{0}; i < N; i += FLIGHT_ROWS) {
+                 std::vector<Metres<T>> metres;
+                 std::vector<Knots<T>> knots;
+                 std::vector<Kelvin<T>> kelvin;
+                 for (std::size_t j{i}; j < i + FLIGHT_ROWS; ++j) {
+                   metres.emplace_back(values[j]);
+                   knots.emplace_back(values[j]);
+                   kelvin.emplace_back(values[j]);
+                 }
+                 do_not_optimize(metres.data());
+                 do_not_optimize(knots.data());
+                 do_not_optimize(kelvin.data());
+               }
+               clobber_memory();
+             }});
+
+  // The arena holds every allocation of the growing columns of a flight.
+  auto buffer{
+      std::make_shared<Array<std::byte>>(12 * FLIGHT_ROWS * sizeof(T))};
+  suite.add({unit_name<T>("UnitTable", "push_back"), vector_name, N,
+             [values, buffer] {
+               std::pmr::monotonic_buffer_resource arena(
+                   buffer->data(), buffer->size(),
+                   std::pmr::null_memory_resource());
+               for (std::size_t i{0}; i < N; i += FLIGHT_ROWS) {
+                 {
+                   UnitTable<Metres<T>, Knots<T>, Kelvin<T>> table(&arena);
+                   for (std::size_t j{i}; j < i + FLIGHT_ROWS; ++j)
+                     table.push_back(Metres<T>(values[j]), Knots<T>(values[j]),
+                                     Kelvin<T>(values[j]));
+                   do_not_optimize(table.template column<0>().data());
+                   do_not_optimize(table.template column<1>().data());
+                   do_not_optimize(table.template column<2>().data());
+                 }
+                 arena.release();
+               }
+               clobber_memory();
+             }});
+}
+
+/// The number of elements in the large array benchmarks: too many to fit in
+/// the caches, so that the conversions are limited by memory bandwidth.
+constexpr std::size_t LARGE_N{std::size_t(1) << 23};
+
+/// A benchmark of the batch conversion of a large array of `In` units to
+/// `Out` units.
+template <typename In, typename Out, typename F>
+auto large_array_benchmark(std::string name, std::string baseline, F f)
+    -> Benchmark {
+  using T = typename In::value_type;
+  std::mt19937 gen{1};
+  std::conditional_t<std::floating_point<T>, std::uniform_real_distribution<T>,
+                     std::uniform_int_distribution<T>>
+      dist{T(1), T(1'000)};
+  auto data{std::make_shared<std::pair<Array<In>, Array<Out>>>()};
+  data->first.reserve(LARGE_N);
+  for (std::size_t i{0}; i < LARGE_N; ++i)
+    data->first.emplace_back(dist(gen));
+  data->second.resize(LARGE_N);
+  return {std::move(name), std::move(baseline), LARGE_N, [data, f] {
+            auto &[in, out]{*data};
+            f(std::span<const In>(in), std::span<Out>(out));
+            clobber_memory();
+          },
+          sizeof(In) + sizeof(Out)};
+}
+
+/// Add the benchmarks of converting large arrays of float, double and
+/// integer units, compared with converting a large array of double units.
+void add_large_array_benchmarks(Suite &suite) {
+  using non_si::Feet;
+  using si::Metres;
+  const auto baseline{unit_name<double>("Feet", "to_metres large array")};
+  suite.add(large_array_benchmark<Feet<float>, Metres<float>>(
+      unit_name<float>("Feet", "to_metres large array"), baseline,
+      [](auto in, auto out) { non_si::to_metres(in, out); }));
+  suite.add(large_array_benchmark<Feet<float>, Metres<double>>(
+      unit_name<float>("Feet", "convert<Metres<double>> large array"),
+      baseline, [](auto in, auto out) { convert(in, out); }));
+  suite.add(large_array_benchmark<non_si::FlightLevels<std::int16_t>,
+                                  Metres<float>>(
+      unit_name<std::int16_t>("FlightLevels",
+                              "convert<Metres<float>> large array"),
+      baseline, [](auto in, auto out) { convert(in, out); }));
+  suite.add(large_array_benchmark<Feet<std::int32_t>, Metres<double>>(
+      unit_name<std::int32_t>("Feet", "convert<Metres<double>> large array"),
+      baseline, [](auto in, auto out) { convert(in, out); }));
+  suite.add(large_array_benchmark<Feet<double>, Metres<double>>(
+      baseline, "", [](auto in, auto out) { non_si::to_metres(in, out); }));
+}
+
+/// Add the benchmarks of the parallel conversion and sum of large arrays of
+/// double units with 1, 2, 4... threads, up to the number of hardware
+/// threads, compared with the sequenced conversion and sum.
+void add_parallel_benchmarks(Suite &suite) {
+  using non_si::Feet;
+  using si::Metres;
+  std::mt19937 gen{1};
+  std::uniform_real_distribution<double> dist{1.0, 1'000.0};
+  auto data{std::make_shared<
+      std::pair<Array<Feet<double>>, Array<Metres<double>>>>()};
+  data->first.reserve(LARGE_N);
+  for (std::size_t i{0}; i < LARGE_N; ++i)
+    data->first.emplace_back(dist(gen));
+  data->second.resize(LARGE_N);
+
+  const auto convert_name{unit_name<double>("Feet", "to_metres large array")};
+  const auto sum_name{unit_name<double>("Feet", "sum large array")};
+  suite.add({sum_name, "", LARGE_N, [data] {
+               do_not_optimize(sum(std::span<const Feet<double>>(data->first)));
+             },
+             sizeof(Feet<double>)});
+
+  const auto hardware_threads{
+      std::max(1u, std::thread::hardware_concurrency())};
+  for (unsigned threads{1}; threads <= hardware_threads;
+       threads = threads < hardware_threads
+                     ? std::min(2 * threads, hardware_threads)
+                     : threads + 1) {
+    const auto suffix{" par " + std::to_string(threads) + " threads"};
+    const auto pool{std::make_shared<ThreadPool>(threads)};
+    const Parallel policy{.pool = pool.get()};
+    suite.add({convert_name + suffix, convert_name, LARGE_N,
+               [data, pool, policy] {
+                 auto &[in, out]{*data};
+                 non_si::to_metres(policy, std::span<const Feet<double>>(in),
+                                   std::span<Metres<double>>(out));
+                 clobber_memory();
+               },
+               sizeof(Feet<double>) + sizeof(Metres<double>)});
+    suite.add({sum_name + suffix, sum_name, LARGE_N, [data, pool, policy] {
+                 do_not_optimize(
+                     sum(policy, std::span<const Feet<double>>(data->first)));
+               },
+               sizeof(Feet<double>)});
+  }
+}
+
+/// Add all the benchmarks for floating point type T.
+template <typename T> void add_benchmarks(Suite &suite) {
+  add_raw_benchmarks<T>(suite);
+
+  add_unit_benchmarks<si::Metres<T>, T>(suite, "Metres");
+  add_unit_benchmarks<si::MetresPerSecond<T>, T>(suite, "MetresPerSecond");
+  add_unit_benchmarks<si::MetresPerSecondSquared<T>, T>(
+      suite, "MetresPerSecondSquared");
+  add_unit_benchmarks<si::Kelvin<T>, T>(suite, "Kelvin");
+  add_unit_benchmarks<si::Pascals<T>, T>(suite, "Pascals");
+  add_unit_benchmarks<si::Kilograms<T>, T>(suite, "Kilograms");
+  add_unit_benchmarks<si::KilogramsPerCubicMetre<T>, T>(
+      suite, "KilogramsPerCubicMetre");
+  add_unit_benchmarks<non_si::NauticalMiles<T>, T>(suite, "NauticalMiles");
+  add_unit_benchmarks<non_si::Feet<T>, T>(suite, "Feet");
+  add_unit_benchmarks<non_si::Knots<T>, T>(suite, "Knots");
+
+  add_conversion_benchmarks<non_si::NauticalMiles<T>, si::Metres<T>, T>(
+      suite, "NauticalMiles", "Metres", "to_metres",
+      [](const non_si::NauticalMiles<T> &v) { return v.to_metres(); });
+  add_conversion_benchmarks<non_si::Feet<T>, si::Metres<T>, T>(
+      suite, "Feet", "Metres", "to_metres",
+      [](const non_si::Feet<T> &v) { return v.to_metres(); });
+  add_conversion_benchmarks<non_si::Knots<T>, si::MetresPerSecond<T>, T>(
+      suite, "Knots", "MetresPerSecond", "to_metres_per_second",
+      [](const non_si::Knots<T> &v) { return v.to_metres_per_second(); });
+  add_convert_benchmarks<T>(suite);
+  add_isa_benchmarks<T>(suite);
+  add_airspeed_benchmarks<T>(suite);
+  add_parse_benchmarks<T>(suite);
+  add_columnar_benchmarks<T>(suite);
+  add_codec_benchmarks<T>(suite);
+  add_expression_benchmarks<T>(suite);
+  add_geodesy_benchmarks<T>(suite);
+  add_kinematics_benchmarks<T>(suite);
+  add_column_benchmarks<T>(suite);
+}
+
+/// Parse an integer command line argument.
+auto parse_int(const std::string_view arg, int &value) -> bool {
+  return std::from_chars(arg.data(), arg.data() + arg.size(), value).ec ==
+         std::errc();
+}
+
+/// Parse a floating point command line argument.
+auto parse_double(const std::string_view arg, double &value) -> bool {
+  return std::from_chars(arg.data(), arg.data() + arg.size(), value).ec ==
+         std::errc();
+}
+} // namespace
+
+auto main(int argc, char *argv[]) -> int {
+  std::string json_file;
+  std::string filter;
+  int repetitions{5};
+  int min_time_ms{10};
+  bool use_counters{false};
+  double min_bandwidth{0.0};
+  for (int i{1}; i < argc; ++i) {
+    const std::string_view arg{argv[i]};
+    const bool has_value{i + 1 < argc};
+    bool ok{true};
+    if (arg == "--counters")
+      use_counters = true;
+    else if (!has_value)
+      ok = false;
+    else if (arg == "--json")
+      json_file = argv[++i];
+    else if (arg == "--filter")
+      filter = argv[++i];
+    else if (arg == "--repetitions")
+      ok = parse_int(argv[++i], repetitions);
+    else if (arg == "--min-time-ms")
+      ok = parse_int(argv[++i], min_time_ms);
+    else if (arg == "--min-bandwidth")
+      ok = parse_double(argv[++i], min_bandwidth) && min_bandwidth > 0.0;
+    else
+      ok = false;
+
+    if (!ok) {
+      std::cerr << "usage: " << argv[0]
+                << " [--json file] [--filter string] [--repetitions n]"
+                   " [--min-time-ms n] [--counters] [--min-bandwidth fraction]"
+                   "\n";
+      return 1;
+    }
+  }
+
+  // count hardware events if requested and available
+  std::optional<PerfCounters> counters;
+  if (use_counters) {
+    counters.emplace();
+    if (!counters->available()) {
+      std::cerr << "hardware counters unavailable, " << counters->error()
+                << '\n';
+      counters.reset();
+    }
+  }
+
+  Suite suite;
+  add_benchmarks<float>(suite);
+  add_benchmarks<double>(suite);
+  add_large_array_benchmarks(suite);
+  add_parallel_benchmarks(suite);
+
+  const std::chrono::milliseconds min_time(min_time_ms);
+  auto results{suite.run(filter, repetitions, min_time,
+                         counters ? &*counters : nullptr)};
+  if (min_bandwidth > 0.0) {
+    const auto bandwidth{memory_bandwidth(repetitions, min_time)};
+    std::cout << "memory bandwidth: " << bandwidth << " bytes/ns\n";
+    mark_bandwidth(results, bandwidth, min_bandwidth);
+  }
+  write_table(std::cout, results);
+  if (!json_file.empty()) {
+    std::ofstream file(json_file);
+    write_json(file, results);
+    if (!file) {
+      std::cerr << "failed to write: " << json_file << '\n';
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief A minimal microbenchmark harness.
+///
+/// Each benchmark runs a loop over an array of elements. The harness repeats
+/// the loop until a minimum time has elapsed and reports the fastest time per
+/// element over several repetitions.
+/// A benchmark may name a baseline benchmark, e.g. the same loop on raw
+/// `double` values, so that the overhead of the unit types can be reported
+/// as the ratio of their times.
+///
+/// The harness can also count hardware events with PerfCounters, to report
+/// the instructions per cycle and bytes per cycle of each benchmark, and
+/// compare the memory bandwidth of each benchmark with the bandwidth of
+/// `std::memcpy`.
+//////////////////////////////////////////////////////////////////////////////
+#include "perf_counters.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace via {
+namespace units {
+namespace bench {
+
+/// Prevent the compiler from optimizing away the calculation of value.
+template <typename T> inline void do_not_optimize(T const &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static_cast<void>(*static_cast<const volatile T *>(&value));
+#endif
+}
+
+/// Prevent the compiler from optimizing away writes to memory.
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+/// A benchmark.
+struct Benchmark {
+  /// The name of the benchmark, e.g. "Feet<double>(Metres)".
+  std::string name;
+  /// The name of the baseline benchmark, empty if none.
+  std::string baseline;
+  /// The number of elements processed by each call of body.
+  std::size_t elements;
+  /// The loop to measure.
+  std::function<void()> body;
+  /// The number of bytes read and written per element, 0 if unknown.
+  std::size_t bytes_per_element{0};
+};
+
+/// The result of running a Benchmark.
+struct Result {
+  std::string name;
+  std::string baseline;
+  std::size_t elements;
+  /// The fastest time per element in nanoseconds.
+  double ns_per_element;
+  /// The ratio of ns_per_element to the baseline's, 0 if no baseline.
+  double baseline_ratio;
+  /// The number of bytes read and written per element, 0 if unknown.
+  std::size_t bytes_per_element{0};
+  /// The hardware counts per element of the fastest repetition.
+  Counts counts{};
+  /// The fraction of the memory bandwidth achieved, 0 if not measured.
+  double bandwidth_fraction{0.0};
+  /// Whether bandwidth_fraction is below the minimum fraction.
+  bool below_bandwidth{false};
+
+  /// The instructions per cycle, if counted.
+  [[nodiscard]] auto ipc() const -> std::optional<double> {
+    if (counts.cycles && counts.instructions && *counts.cycles > 0.0)
+      return *counts.instructions / *counts.cycles;
+    return std::nullopt;
+  }
+
+  /// The bytes read and written per cycle, if known.
+  [[nodiscard]] auto bytes_per_cycle() const -> std::optional<double> {
+    if (bytes_per_element && counts.cycles && *counts.cycles > 0.0)
+      return static_cast<double>(bytes_per_element) / *counts.cycles;
+    return std::nullopt;
+  }
+};
+
+/// A collection of benchmarks.
+class Suite {
+  std::vector<Benchmark> benchmarks_;
+
+public:
+  /// Add a benchmark to the suite.
+  void add(Benchmark benchmark) { benchmarks_.push_back(std::move(benchmark)); }
+
+  /// Run the benchmarks whose names contain filter.
+  /// @param filter the string to match, empty matches all benchmarks.
+  /// @param repetitions the number of times to measure each benchmark.
+  /// @param min_time the minimum time to run each measurement.
+  /// @param counters the hardware counters to count each measurement with,
+  /// nullptr to only measure the time.
+  /// @return the results.
+  auto run(const std::string_view filter, const int repetitions,
+           const std::chrono::nanoseconds min_time,
+           PerfCounters *counters = nullptr) const -> std::vector<Result> {
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<Result> results;
+    for (const auto &benchmark : benchmarks_) {
+      if (!filter.empty() &&
+          benchmark.name.find(filter) == std::string::npos &&
+          benchmark.baseline.find(filter) == std::string::npos)
+        continue;
+
+      // warm up and calibrate the number of iterations
+      std::size_t iterations{1};
+      for (;;) {
+        const auto start{Clock::now()};
+        for (std::size_t i{0}; i < iterations; ++i)
+          benchmark.body();
+        if (Clock::now() - start >= min_time)
+          break;
+        iterations *= 2;
+      }
+
+      auto best{std::chrono::nanoseconds::max()};
+      Counts best_counts;
+      for (int r{0}; r < repetitions; ++r) {
+        if (counters)
+          counters->start();
+        const auto start{Clock::now()};
+        for (std::size_t i{0}; i < iterations; ++i)
+          benchmark.body();
+        const auto time{Clock::now() - start};
+        const auto counts{counters ? counters->stop() : Counts{}};
+        if (time < best) {
+          best = time;
+          best_counts = counts;
+        }
+      }
+
+      const auto total_elements{static_cast<double>(iterations) *
+                                static_cast<double>(benchmark.elements)};
+      const auto ns_per_element{static_cast<double>(best.count()) /
+                                total_elements};
+      results.push_back({benchmark.name, benchmark.baseline,
+                         benchmark.elements, ns_per_element, 0.0,
+                         benchmark.bytes_per_element,
+                         best_counts / total_elements});
+    }
+
+    for (auto &result : results) {
+      const auto baseline{
+          std::ranges::find(results, result.baseline, &Result::name)};
+      if (baseline != results.end() && baseline->ns_per_element > 0.0)
+        result.baseline_ratio =
+            result.ns_per_element / baseline->ns_per_element;
+    }
+    return results;
+  }
+};
+
+/// Measure the memory bandwidth by copying a buffer with `std::memcpy`.
+/// @param repetitions the number of times to measure the copy.
+/// @param min_time the minimum time to run each measurement.
+/// @param size the size of the buffer in bytes, it must be too large to fit
+/// in the caches.
+/// @return the bytes read and written per nanosecond.
+inline auto memory_bandwidth(const int repetitions,
+                             const std::chrono::nanoseconds min_time,
+                             const std::size_t size = std::size_t(1) << 26)
+    -> double {
+  auto buffers{std::make_shared<std::pair<std::vector<char>,
+                                          std::vector<char>>>(
+      std::vector<char>(size, 1), std::vector<char>(size))};
+  Suite suite;
+  suite.add({"memcpy", "", size, [buffers, size] {
+               std::memcpy(buffers->second.data(), buffers->first.data(), size);
+               clobber_memory();
+             }});
+  return 2.0 / suite.run("", repetitions, min_time).front().ns_per_element;
+}
+
+/// Set the fraction of the memory bandwidth achieved by the results that
+/// know their bytes per element, and mark those below min_fraction.
+/// @param results the results.
+/// @param bandwidth the memory bandwidth in bytes per nanosecond.
+/// @param min_fraction the minimum fraction of the memory bandwidth.
+inline void mark_bandwidth(std::vector<Result> &results,
+                           const double bandwidth, const double min_fraction) {
+  for (auto &result : results) {
+    if (result.bytes_per_element == 0 || result.ns_per_element <= 0.0)
+      continue;
+    result.bandwidth_fraction = static_cast<double>(result.bytes_per_element) /
+                                result.ns_per_element / bandwidth;
+    result.below_bandwidth = result.bandwidth_fraction < min_fraction;
+  }
+}
+
+/// Write the results as a table.
+inline void write_table(std::ostream &os, const std::vector<Result> &results) {
+  for (const auto &result : results) {
+    os << result.name << ": " << result.ns_per_element << " ns/element";
+    if (result.baseline_ratio > 0.0)
+      os << ", " << result.baseline_ratio << " x " << result.baseline;
+    if (const auto ipc{result.ipc()})
+      os << ", " << *ipc << " IPC";
+    if (const auto bytes_per_cycle{result.bytes_per_cycle()})
+      os << ", " << *bytes_per_cycle << " bytes/cycle";
+    if (result.counts.l1d_misses)
+      os << ", " << *result.counts.l1d_misses << " L1D misses/element";
+    if (result.counts.llc_misses)
+      os << ", " << *result.counts.llc_misses << " LLC misses/element";
+    if (result.counts.branch_misses)
+      os << ", " << *result.counts.branch_misses << " branch misses/element";
+    if (result.bandwidth_fraction > 0.0)
+      os << ", " << result.bandwidth_fraction << " x memory bandwidth"
+         << (result.below_bandwidth ? " BELOW MINIMUM" : "");
+    os << '\n';
+  }
+}
+
+/// Write the results as JSON.
+inline void write_json(std::ostream &os, const std::vector<Result> &results) {
+  os << "{\n  \"benchmarks\": [";
+  for (std::size_t i{0}; i < results.size(); ++i) {
+    const auto &result{results[i]};
+    os << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name
+       << "\", \"baseline\": \"" << result.baseline
+       << "\", \"elements\": " << result.elements
+       << ", \"ns_per_element\": " << result.ns_per_element
+       << ", \"baseline_ratio\": " << result.baseline_ratio;
+    const auto write_optional{[&os](const char *key,
+                                    const std::optional<double> &value) {
+      if (value)
+        os << ", \"" << key << "\": " << *value;
+    }};
+    write_optional("cycles_per_element", result.counts.cycles);
+    write_optional("instructions_per_element", result.counts.instructions);
+    write_optional("l1d_misses_per_element", result.counts.l1d_misses);
+    write_optional("llc_misses_per_element", result.counts.llc_misses);
+    write_optional("branch_misses_per_element", result.counts.branch_misses);
+    write_optional("ipc", result.ipc());
+    write_optional("bytes_per_cycle", result.bytes_per_cycle());
+    if (result.bandwidth_fraction > 0.0)
+      os << ", \"bandwidth_fraction\": " << result.bandwidth_fraction
+         << ", \"below_bandwidth\": "
+         << (result.below_bandwidth ? "true" : "false");
+    os << "}";
+  }
+  os << "\n  ]\n}\n";
+}
+
+} // namespace bench
+} // namespace units
+} // namespace via
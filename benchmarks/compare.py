@@ -0,0 +1,79 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Ken Barker
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+#  @file compare
+#  @brief Compares via-units_bench JSON results with a baseline file.
+#
+#  By default the benchmarks are compared by their `baseline_ratio`: the ratio
+#  of a unit benchmark's time to the same loop on raw floating point values.
+#  The ratio is largely independent of the machine, so it can be compared with
+#  the checked-in baseline.json. Use `--metric ns_per_element` to compare the
+#  absolute times of results from the same machine.
+#
+#  Exits with status 1 if any benchmark regressed.
+
+import argparse
+import json
+import sys
+
+def load(filename):
+    with open(filename) as file:
+        return {b['name']: b for b in json.load(file)['benchmarks']}
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('results', help='the via-units_bench --json file')
+    parser.add_argument('baseline', help='the baseline --json file')
+    parser.add_argument('--metric', default='baseline_ratio',
+                        choices=['baseline_ratio', 'ns_per_element'])
+    parser.add_argument('--tolerance', type=float, default=0.25,
+                        help='the fractional increase that is a regression')
+    parser.add_argument('--max-overhead', type=float, default=1.25,
+                        help='the maximum baseline_ratio of a unit benchmark')
+    args = parser.parse_args()
+
+    results = load(args.results)
+    baseline = load(args.baseline)
+
+    failures = 0
+    for name, result in results.items():
+        value = result[args.metric]
+        if value <= 0.0:
+            continue
+
+        status = 'ok'
+        if result['baseline_ratio'] > args.max_overhead:
+            status = 'OVERHEAD'
+        if name in baseline and baseline[name][args.metric] > 0.0:
+            change = value / baseline[name][args.metric] - 1.0
+            if change > args.tolerance:
+                status = 'REGRESSION'
+            print(f'{status:10} {name}: {value:.3f} ({change:+.1%})')
+        else:
+            print(f'{status:10} {name}: {value:.3f} (new)')
+        failures += status != 'ok'
+
+    print(f'{failures} of {len(results)} benchmarks failed')
+    return 1 if failures else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
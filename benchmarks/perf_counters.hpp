@@ -0,0 +1,196 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Hardware performance counters for the microbenchmark harness.
+///
+/// On Linux, PerfCounters opens a group of hardware counters for the calling
+/// thread with `perf_event_open`: cycles, instructions, L1 data cache read
+/// misses, last level cache misses and branch misses.
+/// The counters are often unavailable, e.g. in containers and virtual machines
+/// or when `/proc/sys/kernel/perf_event_paranoid` forbids them, in which case
+/// PerfCounters is not available and the counts are empty.
+/// Counters that the processor does not support are left empty.
+/// On other platforms the counters are never available.
+//////////////////////////////////////////////////////////////////////////////
+#include <optional>
+#include <string>
+#ifdef __linux__
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace via {
+namespace units {
+namespace bench {
+
+/// The counts of hardware events, empty if not counted.
+struct Counts {
+  std::optional<double> cycles;
+  std::optional<double> instructions;
+  std::optional<double> l1d_misses;
+  std::optional<double> llc_misses;
+  std::optional<double> branch_misses;
+
+  /// The counts divided by divisor, e.g. the number of elements.
+  [[nodiscard]] auto operator/(const double divisor) const -> Counts {
+    const auto divide{[divisor](const std::optional<double> &count) {
+      return count ? std::optional<double>(*count / divisor) : std::nullopt;
+    }};
+    return {divide(cycles), divide(instructions), divide(l1d_misses),
+            divide(llc_misses), divide(branch_misses)};
+  }
+};
+
+/// A group of hardware performance counters for the calling thread.
+/// Note: threads other than the calling thread, e.g. in a ThreadPool, are
+/// not counted.
+class PerfCounters {
+#ifdef __linux__
+  struct Event {
+    std::uint32_t type;
+    std::uint64_t config;
+    std::optional<double> Counts::*count;
+  };
+
+  static constexpr std::array<Event, 5> EVENTS{{
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, &Counts::cycles},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, &Counts::instructions},
+      {PERF_TYPE_HW_CACHE,
+       PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+       &Counts::l1d_misses},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, &Counts::llc_misses},
+      {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,
+       &Counts::branch_misses},
+  }};
+
+  /// The file descriptors of the events, -1 if not opened.
+  /// The first event, cycles, is the group leader.
+  std::array<int, EVENTS.size()> fds_;
+
+  /// Open an event for the calling thread on any cpu, in the group of
+  /// group_fd or as a group leader if group_fd is -1.
+  static auto open_event(const Event &event, const int group_fd) -> int {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // the leader starts disabled, the other events follow the leader
+    attr.disabled = group_fd == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  [[nodiscard]] auto leader() const -> int { return fds_.front(); }
+#endif
+  std::string error_;
+
+public:
+  /// Open the counters, check available() for whether they were opened.
+  PerfCounters() {
+#ifdef __linux__
+    fds_.fill(-1);
+    fds_.front() = open_event(EVENTS.front(), -1);
+    if (leader() == -1) {
+      error_ = std::string("perf_event_open: ") + std::strerror(errno);
+      return;
+    }
+    for (std::size_t i{1}; i < EVENTS.size(); ++i)
+      fds_[i] = open_event(EVENTS[i], leader());
+#else
+    error_ = "perf_event_open is only supported on Linux";
+#endif
+  }
+
+  ~PerfCounters() {
+#ifdef __linux__
+    for (const auto fd : fds_)
+      if (fd != -1)
+        close(fd);
+#endif
+  }
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+  /// Whether the counters are available.
+  [[nodiscard]] auto available() const -> bool { return error_.empty(); }
+
+  /// The reason why the counters are not available, empty if they are.
+  [[nodiscard]] auto error() const -> const std::string & { return error_; }
+
+  /// Reset and start the counters.
+  void start() {
+#ifdef __linux__
+    if (available()) {
+      ioctl(leader(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(leader(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  /// Stop the counters.
+  /// @return the counts since start, scaled up if the kernel multiplexed the
+  /// counters with other events. Empty if the counters are not available.
+  auto stop() -> Counts {
+    Counts counts;
+#ifdef __linux__
+    if (!available())
+      return counts;
+
+    ioctl(leader(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    struct {
+      std::uint64_t nr;
+      std::uint64_t time_enabled;
+      std::uint64_t time_running;
+      std::array<std::uint64_t, EVENTS.size()> values;
+    } data{};
+    if (read(leader(), &data, sizeof(data)) <= 0 || data.time_running == 0)
+      return counts;
+
+    const auto scale{static_cast<double>(data.time_enabled) /
+                     static_cast<double>(data.time_running)};
+    // the values are in the order that the events joined the group
+    std::size_t v{0};
+    for (std::size_t i{0}; i < EVENTS.size() && v < data.nr; ++i)
+      if (fds_[i] != -1)
+        counts.*EVENTS[i].count = static_cast<double>(data.values[v++]) * scale;
+#endif
+    return counts;
+  }
+};
+
+} // namespace bench
+} // namespace units
+} // namespace via
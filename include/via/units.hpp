@@ -34,6 +34,44 @@
 /// (ISA),
 /// - the [non-SI](../../include/via/units/non_si.hpp) units defined in
 /// ICAO Annex 5 Table 3-3,
-/// - and conversions between SI and non-SI units.
+/// - conversions between SI and non-SI units,
+/// - allocation free [formatting](../../include/via/units/quantity.hpp),
+/// with `to_chars` and `std::format`,
+/// - [parsing](../../include/via/units/parse.hpp) of values with unit symbols,
+/// e.g. "250kt" or "FL350",
+/// - compile-time [dimensional analysis](../../include/via/units/quantity.hpp),
+/// e.g. `Metres / Seconds` is `MetresPerSecond`,
+/// - [batch](../../include/via/units/batch.hpp) conversions over spans
+/// of units, using explicit SIMD instructions and, optionally, the threads
+/// of a [thread pool](../../include/via/units/parallel.hpp),
+/// - [columns](../../include/via/units/column.hpp) of units in aligned
+/// structure of arrays storage, allocated from `std::pmr` memory resources,
+/// - lazy [expressions](../../include/via/units/expression.hpp) over spans
+/// and columns of units, evaluated in a single fused SIMD pass,
+/// - a memory mapped [columnar file format](../../include/via/units/columnar.hpp)
+/// for columns of units, which is not included by this header since it
+/// includes the platform's file mapping headers,
+/// - a [codec](../../include/via/units/codec.hpp) that quantises, delta
+/// encodes and bit packs series of units for storage and transport,
+/// - great circle and ellipsoidal [distances and bearings](../../include/via/units/geodesy.hpp)
+/// between positions,
+/// - [kinematic integration](../../include/via/units/kinematics.hpp) of
+/// spans of positions and speeds over time steps,
+/// - the [International Standard Atmosphere](../../include/via/units/isa.hpp)
+/// (ISA) up to 80 km, evaluated exactly or from tabulated polynomials,
+/// - conversions between calibrated, equivalent and true
+/// [airspeeds](../../include/via/units/airspeed.hpp) and Mach numbers,
+/// - and opt-in [tracing](../../include/via/units/trace.hpp) of the calls of
+/// the batch functions, which compiles to nothing unless `VIA_UNITS_TRACE`
+/// is defined.
 ///
-#include "units/non_si.hpp"
+#include "units/airspeed.hpp"
+#include "units/batch.hpp"
+#include "units/codec.hpp"
+#include "units/column.hpp"
+#include "units/expression.hpp"
+#include "units/geodesy.hpp"
+#include "units/isa.hpp"
+#include "units/kinematics.hpp"
+#include "units/parse.hpp"
+#include "units/trace.hpp"
@@ -0,0 +1,642 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Airspeeds: calibrated (CAS), equivalent (EAS) and true (TAS)
+/// airspeeds and Mach numbers.
+///
+/// The airspeeds are converted with the compressible flow equations and the
+/// pressure and speed of sound of the International Standard Atmosphere at a
+/// pressure altitude, with an optional deviation from the ISA temperature.
+/// Every conversion is calculated via the Mach number (M):
+///
+/// - CAS: from the impact pressure of the CAS at mean sea level,
+/// - EAS: EAS = M a0 sqrt(delta),
+/// - TAS: TAS = M a,
+///
+/// where a0 is the speed of sound at mean sea level, a the speed of sound and
+/// delta the ratio of the pressure to the pressure at mean sea level.
+/// The impact pressure of a CAS or Mach number is calculated by the subsonic
+/// compressible flow equation up to Mach 1 and by the Rayleigh supersonic
+/// pitot tube equation above it, selected for each value, since a subsonic
+/// CAS is supersonic at high altitudes, see `is_subsonic`.
+///
+/// The fractional powers of the compressible flow equations are evaluated by
+/// kernels that only add, multiply, divide, take square roots and select:
+/// x^3.5 is x^3 sqrt(x), x^(2/7) is a polynomial refined by Newton-Raphson
+/// iterations and the inverse of the Rayleigh equation is solved by Newton's
+/// method, instead of calling `pow`, and the differences of the powers from
+/// one are factorised, so that they do not lose precision at low speeds.
+/// The same kernels evaluate the scalar `convert` functions and the SIMD lanes
+/// of the batch `convert` functions.
+//////////////////////////////////////////////////////////////////////////////
+#include "batch.hpp"
+#include "isa.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace via {
+namespace units {
+namespace airspeed {
+
+/// The calibrated airspeed kind.
+struct Calibrated {};
+
+/// The equivalent airspeed kind.
+struct Equivalent {};
+
+/// The true airspeed kind.
+struct True {};
+
+/// An airspeed of kind K, in the speed unit U, e.g. Knots or MetresPerSecond.
+template <typename K, typename U>
+  requires std::same_as<typename U::dimension, Speed>
+class Airspeed final {
+  U speed_;
+
+public:
+  using kind = K;
+  using unit = U;
+  using value_type = typename U::value_type;
+
+  /// Constructor
+  constexpr explicit Airspeed(const U speed) noexcept : speed_{speed} {}
+
+  /// Default constructor
+  constexpr Airspeed() noexcept = default;
+
+  /// The accessor for the speed.
+  [[nodiscard("Pure Function")]]
+  constexpr auto speed() const noexcept -> U {
+    return speed_;
+  }
+
+  /// The accessor for the value of the speed.
+  [[nodiscard("Pure Function")]]
+  constexpr auto v() const noexcept -> value_type {
+    return speed_.v();
+  }
+
+  /// The spaceship operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator<=>(const Airspeed &other) const noexcept
+      -> std::partial_ordering {
+    return speed_ <=> other.speed_;
+  }
+
+  /// The equality operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator==(const Airspeed &other) const noexcept -> bool {
+    return speed_ == other.speed_;
+  }
+};
+
+/// A calibrated airspeed (CAS).
+template <typename U> using Cas = Airspeed<Calibrated, U>;
+
+/// An equivalent airspeed (EAS).
+template <typename U> using Eas = Airspeed<Equivalent, U>;
+
+/// A true airspeed (TAS).
+template <typename U> using Tas = Airspeed<True, U>;
+
+/// A Mach number: the ratio of the true airspeed to the speed of sound.
+template <typename T>
+  requires std::floating_point<T>
+class Mach final {
+  T v_;
+
+public:
+  using kind = Mach;
+  using value_type = T;
+
+  /// Constructor
+  constexpr explicit Mach(const T value) noexcept : v_{value} {}
+
+  /// Default constructor
+  constexpr Mach() noexcept = default;
+
+  /// The accessor for v.
+  [[nodiscard("Pure Function")]]
+  constexpr auto v() const noexcept -> T {
+    return v_;
+  }
+
+  /// The spaceship operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator<=>(const Mach &other) const noexcept
+      -> std::partial_ordering {
+    return v_ <=> other.v_;
+  }
+
+  /// The equality operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator==(const Mach &other) const noexcept -> bool {
+    return v_ == other.v_;
+  }
+};
+
+namespace detail {
+
+template <typename A> struct is_airspeed : std::false_type {};
+
+template <typename K, typename U>
+struct is_airspeed<Airspeed<K, U>> : std::true_type {};
+
+template <typename T> struct is_airspeed<Mach<T>> : std::true_type {};
+
+} // namespace detail
+
+/// An airspeed or a Mach number.
+template <typename A>
+concept AnyAirspeed = detail::is_airspeed<A>::value;
+
+} // namespace airspeed
+
+/// The name of an airspeed for tracing, e.g. "Cas<Knots<double>>".
+template <typename K, typename U>
+struct trace::type_name<airspeed::Airspeed<K, U>> {
+  static auto get() -> std::string {
+    const char *kind{std::same_as<K, airspeed::Calibrated> ? "Cas"
+                     : std::same_as<K, airspeed::Equivalent> ? "Eas"
+                                                             : "Tas"};
+    return kind + ('<' + type_name<U>::get() + '>');
+  }
+};
+
+/// The name of a Mach number for tracing, e.g. "Mach<double>".
+template <typename T> struct trace::type_name<airspeed::Mach<T>> {
+  static auto get() -> std::string {
+    return "Mach<" + type_name<T>::get() + '>';
+  }
+};
+
+namespace airspeed {
+
+/// The speed of sound at mean sea level (a0).
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::MetresPerSecond<T> SEA_LEVEL_SPEED_OF_SOUND{
+    isa::speed_of_sound(isa::SEA_LEVEL_TEMPERATURE<T>)};
+
+/// The state of the atmosphere used to convert airspeeds.
+template <typename T>
+  requires std::floating_point<T>
+struct Atmosphere {
+  /// The ratio of the pressure to the pressure at mean sea level (delta).
+  T pressure_ratio;
+  /// The speed of sound in metres per second (a).
+  T speed_of_sound;
+};
+
+/// The atmosphere at a pressure altitude.
+/// @tparam P the ISA evaluation policy, Exact or Fast.
+/// @param altitude the pressure altitude in Metres or Feet, i.e. the
+/// geopotential altitude of the pressure in the ISA.
+/// @param deviation the deviation of the temperature from the ISA temperature.
+/// @return the pressure ratio and speed of sound at the altitude.
+template <isa::Policy P = isa::Exact, typename A,
+          typename T = typename A::value_type>
+  requires std::same_as<typename A::dimension, Length>
+[[nodiscard("Pure Function")]]
+constexpr auto atmosphere(const A altitude,
+                          const si::Kelvin<T> deviation = {}) noexcept
+    -> Atmosphere<T> {
+  return {isa::pressure<P>(altitude).v() / isa::SEA_LEVEL_PRESSURE<T>.v(),
+          isa::speed_of_sound(isa::temperature<P>(altitude) + deviation).v()};
+}
+
+namespace detail {
+
+/// x^3.5, calculated as x^3 sqrt(x).
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto pow_7_2(const typename V::type x) noexcept -> typename V::type {
+  return V::mul(V::mul(V::mul(x, x), x), V::sqrt(x));
+}
+
+/// x^(2/7), calculated from a quadratic approximation over [1, 2], with a
+/// maximum relative error of 1.2e-3, refined by Newton-Raphson iterations of
+/// z^7 = x^2: two for float and three for double.
+/// @pre 1 <= x <= 2, i.e. a subsonic Mach number or CAS.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto pow_2_7(const typename V::type x) noexcept -> typename V::type {
+  constexpr int ITERATIONS{std::same_as<T, float> ? 2 : 3};
+
+  auto z{V::add(V::broadcast(static_cast<T>(0.678'468)),
+                V::mul(x, V::add(V::broadcast(static_cast<T>(0.375'638)),
+                                 V::mul(x, V::broadcast(static_cast<T>(
+                                               -0.052'911'1))))))};
+  const auto x2{V::mul(x, x)};
+  const auto six{V::broadcast(static_cast<T>(6))};
+  const auto seven{V::broadcast(static_cast<T>(7))};
+  for (int i{0}; i < ITERATIONS; ++i) {
+    const auto z2{V::mul(z, z)};
+    const auto z6{V::mul(V::mul(z2, z2), z2)};
+    z = V::div(V::add(V::mul(six, z), V::div(x2, z6)), seven);
+  }
+  return z;
+}
+
+/// The sum of the powers of x from x^0 to x^6, by Horner's method.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto sum_of_powers_6(const typename V::type x) noexcept ->
+    typename V::type {
+  const auto one{V::broadcast(static_cast<T>(1))};
+  auto sum{V::add(x, one)};
+  for (int i{0}; i < 5; ++i)
+    sum = V::add(V::mul(sum, x), one);
+  return sum;
+}
+
+/// The ratio of the impact pressure to the pressure at Mach 1: 1.2^3.5 - 1.
+template <typename T>
+constexpr T SONIC_IMPACT_PRESSURE_RATIO{
+    static_cast<T>(0.892'929'158'737'854'1)};
+
+/// 1.2^3.5 6^2.5, the factor of the Rayleigh supersonic pitot tube equation.
+template <typename T>
+constexpr T RAYLEIGH_FACTOR{static_cast<T>(166.921'580'093'168'3)};
+
+/// The ratio of the impact pressure to the pressure at a subsonic Mach
+/// number: (1 + 0.2 M^2)^3.5 - 1.
+/// It is calculated as (a^7 - 1) / (a^3.5 + 1), where a = 1 + 0.2 M^2 and
+/// a^7 - 1 = (a - 1)(a^6 + ... + 1), so that it does not lose precision by
+/// cancellation at low Mach numbers.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto subsonic_impact_pressure_ratio(
+    const typename V::type mach) noexcept -> typename V::type {
+  const auto one{V::broadcast(static_cast<T>(1))};
+  const auto u{V::mul(V::broadcast(static_cast<T>(0.2)), V::mul(mach, mach))};
+  const auto a{V::add(one, u)};
+  return V::div(V::mul(u, sum_of_powers_6<T, V>(a)),
+                V::add(pow_7_2<T, V>(a), one));
+}
+
+/// The Mach number at a subsonic ratio of the impact pressure to the
+/// pressure: sqrt(5 ((q + 1)^(2/7) - 1)).
+/// It is calculated as sqrt(5 q (q + 2) / (z^6 + ... + 1)), where
+/// z = (q + 1)^(2/7), since z^7 - 1 = (q + 1)^2 - 1 = q (q + 2), so that it
+/// does not lose precision by cancellation at low Mach numbers.
+/// @pre 0 <= q <= SONIC_IMPACT_PRESSURE_RATIO
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto subsonic_mach_number(const typename V::type q) noexcept ->
+    typename V::type {
+  const auto z{pow_2_7<T, V>(V::add(q, V::broadcast(static_cast<T>(1))))};
+  return V::sqrt(V::div(
+      V::mul(V::broadcast(static_cast<T>(5)),
+             V::mul(q, V::add(q, V::broadcast(static_cast<T>(2))))),
+      sum_of_powers_6<T, V>(z)));
+}
+
+/// The Rayleigh supersonic pitot tube equation in u = M^2, plus one:
+/// 1.2^3.5 6^2.5 u^3 sqrt(u / w) / w^2, where w = 7u - 1.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto rayleigh(const typename V::type u) noexcept ->
+    typename V::type {
+  const auto w{V::sub(V::mul(V::broadcast(static_cast<T>(7)), u),
+                      V::broadcast(static_cast<T>(1)))};
+  return V::div(V::mul(V::mul(V::broadcast(RAYLEIGH_FACTOR<T>),
+                              V::mul(V::mul(u, u), u)),
+                       V::sqrt(V::div(u, w))),
+                V::mul(w, w));
+}
+
+/// The ratio of the impact pressure to the pressure at a supersonic Mach
+/// number, by the Rayleigh supersonic pitot tube equation:
+/// (1.2 M^2)^3.5 (6 / (7 M^2 - 1))^2.5 - 1.
+/// @pre M >= 1
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto supersonic_impact_pressure_ratio(
+    const typename V::type mach) noexcept -> typename V::type {
+  return V::sub(rayleigh<T, V>(V::mul(mach, mach)),
+                V::broadcast(static_cast<T>(1)));
+}
+
+/// The Mach number at a supersonic ratio of the impact pressure to the
+/// pressure, the inverse of the Rayleigh supersonic pitot tube equation.
+/// It is solved for u = M^2 by Newton's method from the asymptote of the
+/// equation, u = (q + 1) / (1.2^3.5 (6/7)^2.5) - 5/14: three iterations for
+/// float and four for double, within 1 ulp above Mach 1.
+/// @pre q >= SONIC_IMPACT_PRESSURE_RATIO
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto supersonic_mach_number(const typename V::type q) noexcept ->
+    typename V::type {
+  constexpr int ITERATIONS{std::same_as<T, float> ? 3 : 4};
+
+  const auto one{V::broadcast(static_cast<T>(1))};
+  const auto seven{V::broadcast(static_cast<T>(7))};
+  const auto p{V::add(q, one)};
+  auto u{V::sub(V::div(p, V::broadcast(static_cast<T>(1.287'559'735'791'467))),
+                V::broadcast(static_cast<T>(5.0 / 14.0)))};
+  for (int i{0}; i < ITERATIONS; ++i) {
+    // The derivative of log(rayleigh(u)) is (7u - 3.5) / (u (7u - 1)).
+    const auto w{V::sub(V::mul(seven, u), one)};
+    const auto ratio{V::div(p, rayleigh<T, V>(u))};
+    u = V::sub(u, V::div(V::mul(V::sub(one, ratio), V::mul(u, w)),
+                         V::sub(V::mul(seven, u),
+                                V::broadcast(static_cast<T>(3.5)))));
+  }
+  return V::sqrt(u);
+}
+
+/// The ratio of the impact pressure to the pressure at a Mach number.
+/// The supersonic equation is only evaluated if a lane is supersonic.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto impact_pressure_ratio(const typename V::type mach) noexcept ->
+    typename V::type {
+  const auto one{V::broadcast(static_cast<T>(1))};
+  // min(mach, 1) and max(mach, 1), which propagate NaN.
+  const auto subsonic{
+      subsonic_impact_pressure_ratio<T, V>(V::select_less(one, mach, one, mach))};
+  if (!V::any_less(one, mach))
+    return subsonic;
+  return V::select_less(one, mach,
+                        supersonic_impact_pressure_ratio<T, V>(
+                            V::select_less(mach, one, one, mach)),
+                        subsonic);
+}
+
+/// The Mach number at a ratio of the impact pressure to the pressure.
+/// The supersonic equation is only evaluated if a lane is supersonic.
+template <typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto mach_number(const typename V::type q) noexcept ->
+    typename V::type {
+  const auto sonic{V::broadcast(SONIC_IMPACT_PRESSURE_RATIO<T>)};
+  // min(q, sonic) and max(q, sonic), which propagate NaN.
+  const auto subsonic{
+      subsonic_mach_number<T, V>(V::select_less(sonic, q, sonic, q))};
+  if (!V::any_less(sonic, q))
+    return subsonic;
+  return V::select_less(
+      sonic, q, supersonic_mach_number<T, V>(V::select_less(q, sonic, sonic, q)),
+      subsonic);
+}
+
+/// Whether the values of an airspeed are in metres per second, or are Mach
+/// numbers.
+template <typename A> constexpr bool is_si{true};
+
+template <typename K, typename U>
+constexpr bool is_si<Airspeed<K, U>>{
+    std::ratio_equal_v<typename U::ratio, std::ratio<1>>};
+
+/// The value of an airspeed in metres per second, or a Mach number.
+template <typename A, typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto to_si(const typename V::type x) noexcept -> typename V::type {
+  if constexpr (is_si<A>)
+    return x;
+  else
+    return V::mul(V::broadcast(A::unit::si_factor), x);
+}
+
+/// The value of an airspeed from metres per second, or a Mach number.
+template <typename A, typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto from_si(const typename V::type x) noexcept -> typename V::type {
+  if constexpr (is_si<A>)
+    return x;
+  else
+    return V::div(x, V::broadcast(A::unit::si_factor));
+}
+
+/// Convert the value of an airspeed of type From to type To.
+/// @param x the value of the airspeed.
+/// @param delta the pressure ratio.
+/// @param a the speed of sound in metres per second.
+/// @return the value of the converted airspeed.
+template <typename To, typename From, typename T, typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const typename V::type x,
+                       const typename V::type delta,
+                       const typename V::type a) noexcept -> typename V::type {
+  const auto si{to_si<From, T, V>(x)};
+  if constexpr (std::same_as<typename To::kind, typename From::kind>)
+    return from_si<To, T, V>(si);
+  else {
+    const auto a0{V::broadcast(SEA_LEVEL_SPEED_OF_SOUND<T>.v())};
+
+    typename V::type mach;
+    if constexpr (std::same_as<typename From::kind, Calibrated>)
+      mach = mach_number<T, V>(
+          V::div(impact_pressure_ratio<T, V>(V::div(si, a0)), delta));
+    else if constexpr (std::same_as<typename From::kind, Equivalent>)
+      mach = V::div(si, V::mul(a0, V::sqrt(delta)));
+    else if constexpr (std::same_as<typename From::kind, True>)
+      mach = V::div(si, a);
+    else
+      mach = si;
+
+    if constexpr (std::same_as<typename To::kind, Calibrated>)
+      return from_si<To, T, V>(V::mul(
+          a0, mach_number<T, V>(
+                  V::mul(impact_pressure_ratio<T, V>(mach), delta))));
+    else if constexpr (std::same_as<typename To::kind, Equivalent>)
+      return from_si<To, T, V>(V::mul(mach, V::mul(a0, V::sqrt(delta))));
+    else if constexpr (std::same_as<typename To::kind, True>)
+      return from_si<To, T, V>(V::mul(mach, a));
+    else
+      return mach;
+  }
+}
+
+/// Construct an airspeed or Mach number from its value.
+template <typename A, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto make(const T value) noexcept -> A {
+  if constexpr (std::same_as<A, Mach<T>>)
+    return A(value);
+  else
+    return A(typename A::unit(value));
+}
+
+/// The number of values in each block of the batch conversions.
+constexpr std::size_t BLOCK_SIZE{256};
+
+} // namespace detail
+
+/// Whether an airspeed or Mach number is subsonic in an atmosphere.
+/// Note: a subsonic CAS is supersonic at high altitudes, e.g. a CAS above
+/// 279 knots at 45,000 feet, where `convert` uses the Rayleigh supersonic
+/// pitot tube equation.
+/// @param from the airspeed or Mach number.
+/// @param atmosphere the pressure ratio and speed of sound.
+/// @return true if the Mach number is not greater than one.
+template <typename From, typename T = typename From::value_type>
+  requires AnyAirspeed<From>
+[[nodiscard("Pure Function")]]
+constexpr auto is_subsonic(const From from,
+                           const Atmosphere<T> &atmosphere) noexcept -> bool {
+  return !(detail::convert<Mach<T>, From, T, simd::Scalar<T>>(
+               from.v(), atmosphere.pressure_ratio,
+               atmosphere.speed_of_sound) > T(1));
+}
+
+/// Whether an airspeed or Mach number is subsonic at a pressure altitude.
+/// @tparam P the ISA evaluation policy, Exact or Fast.
+/// @param from the airspeed or Mach number.
+/// @param altitude the pressure altitude in Metres or Feet.
+/// @param deviation the deviation of the temperature from the ISA temperature.
+/// @return true if the Mach number is not greater than one.
+template <isa::Policy P = isa::Exact, typename From, typename A,
+          typename T = typename From::value_type>
+  requires AnyAirspeed<From> && std::same_as<typename A::dimension, Length>
+[[nodiscard("Pure Function")]]
+constexpr auto is_subsonic(const From from, const A altitude,
+                           const si::Kelvin<T> deviation = {}) noexcept
+    -> bool {
+  return is_subsonic(from, atmosphere<P>(altitude, deviation));
+}
+
+/// Convert an airspeed or Mach number, e.g. a CAS in Knots to a TAS in
+/// MetresPerSecond, in an atmosphere.
+/// @param from the airspeed or Mach number to convert.
+/// @param atmosphere the pressure ratio and speed of sound.
+/// @return the converted airspeed or Mach number.
+template <typename To, typename From,
+          typename T = typename From::value_type>
+  requires AnyAirspeed<To> && AnyAirspeed<From> &&
+           std::same_as<typename To::value_type, T>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const From from,
+                       const Atmosphere<T> &atmosphere) noexcept -> To {
+  return detail::make<To>(detail::convert<To, From, T, simd::Scalar<T>>(
+      from.v(), atmosphere.pressure_ratio, atmosphere.speed_of_sound));
+}
+
+/// Convert an airspeed or Mach number at a pressure altitude, e.g.:
+/// `convert<Tas<Knots<double>>>(Cas<Knots<double>>(...), Feet<double>(...))`.
+/// @tparam P the ISA evaluation policy, Exact or Fast.
+/// @param from the airspeed or Mach number to convert.
+/// @param altitude the pressure altitude in Metres or Feet.
+/// @param deviation the deviation of the temperature from the ISA temperature.
+/// @return the converted airspeed or Mach number.
+template <typename To, isa::Policy P = isa::Exact, typename From,
+          typename A, typename T = typename From::value_type>
+  requires AnyAirspeed<To> && AnyAirspeed<From> &&
+           std::same_as<typename To::value_type, T> &&
+           std::same_as<typename A::dimension, Length>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const From from, const A altitude,
+                       const si::Kelvin<T> deviation = {}) noexcept -> To {
+  return convert<To>(from, atmosphere<P>(altitude, deviation));
+}
+
+/// Convert airspeeds or Mach numbers at pressure altitudes.
+/// The atmosphere of each block of altitudes is evaluated first, then the
+/// airspeeds of the block are converted in SIMD lanes.
+/// @pre altitudes.size() >= in.size() and out.size() >= in.size()
+/// @tparam P the ISA evaluation policy, Exact or Fast.
+/// @param in the airspeeds or Mach numbers to convert.
+/// @param altitudes the pressure altitudes in Metres or Feet.
+/// @param out the converted airspeeds or Mach numbers.
+/// @param deviation the deviation of the temperature from the ISA temperature.
+template <typename To, isa::Policy P = isa::Exact, typename From,
+          typename A, typename T = typename From::value_type>
+  requires AnyAirspeed<To> && AnyAirspeed<From> &&
+           std::same_as<typename To::value_type, T> &&
+           std::same_as<typename A::dimension, Length>
+void convert(std::span<const From> in, std::span<const A> altitudes,
+             std::span<To> out, const si::Kelvin<T> deviation = {}) noexcept {
+  using V = simd::Lanes<T>;
+  using S = simd::Scalar<T>;
+  assert(in.size() <= altitudes.size() && in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("airspeed::convert", in.size(), From, To);
+  const auto n{in.size()};
+  // Airspeeds and Mach numbers have the layout of their values.
+  static_assert(sizeof(From) == sizeof(T) && sizeof(To) == sizeof(T) &&
+                std::is_standard_layout_v<From> &&
+                std::is_standard_layout_v<To>);
+  const auto *src{reinterpret_cast<const T *>(in.data())};
+  auto *dst{reinterpret_cast<T *>(out.data())};
+
+  alignas(64) std::array<T, detail::BLOCK_SIZE> delta;
+  alignas(64) std::array<T, detail::BLOCK_SIZE> a;
+  for (std::size_t first{0}; first < n; first += detail::BLOCK_SIZE) {
+    const auto count{std::min(detail::BLOCK_SIZE, n - first)};
+    for (std::size_t i{0}; i < count; ++i) {
+      const auto state{atmosphere<P>(altitudes[first + i], deviation)};
+      delta[i] = state.pressure_ratio;
+      a[i] = state.speed_of_sound;
+    }
+
+    std::size_t i{0};
+    for (; i + V::size <= count; i += V::size)
+      V::store(dst + first + i,
+               detail::convert<To, From, T, V>(V::load(src + first + i),
+                                               V::load(delta.data() + i),
+                                               V::load(a.data() + i)));
+    for (; i < count; ++i)
+      dst[first + i] =
+          detail::convert<To, From, T, S>(src[first + i], delta[i], a[i]);
+  }
+}
+
+/// Convert airspeeds or Mach numbers at pressure altitudes, with an
+/// execution policy.
+/// @pre altitudes.size() >= in.size() and out.size() >= in.size()
+/// @tparam P the ISA evaluation policy, Exact or Fast.
+/// @param policy the execution policy: seq or par.
+/// @param in the airspeeds or Mach numbers to convert.
+/// @param altitudes the pressure altitudes in Metres or Feet.
+/// @param out the converted airspeeds or Mach numbers.
+/// @param deviation the deviation of the temperature from the ISA temperature.
+template <typename To, isa::Policy P = isa::Exact, ExecutionPolicy E,
+          typename From, typename A, typename T = typename From::value_type>
+  requires AnyAirspeed<To> && AnyAirspeed<From> &&
+           std::same_as<typename To::value_type, T> &&
+           std::same_as<typename A::dimension, Length>
+void convert(const E &policy, std::span<const From> in,
+             std::span<const A> altitudes, std::span<To> out,
+             const si::Kelvin<T> deviation = {}) {
+  assert(in.size() <= altitudes.size() && in.size() <= out.size());
+  units::detail::for_each_chunk<T>(
+      policy, in.size(),
+      [in, altitudes, out, deviation](const std::size_t first,
+                                      const std::size_t count) {
+        convert<To, P>(in.subspan(first, count),
+                       altitudes.subspan(first, count),
+                       out.subspan(first, count), deviation);
+      });
+}
+
+} // namespace airspeed
+} // namespace units
+} // namespace via
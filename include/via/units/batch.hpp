@@ -0,0 +1,376 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Batch conversions between SI and non-SI units.
+///
+/// The conversions operate on spans of units using the explicit SIMD kernels
+/// in simd.hpp. Float units may be converted to double units and summed in
+/// double, so that float storage does not lose precision in calculations.
+/// The results are bit-for-bit identical to converting each value with the
+/// scalar constructors and `to_` functions in non_si.hpp, or with the scalar
+/// `convert` function in quantity.hpp.
+///
+/// Each batch function has an overload with an execution policy from
+/// parallel.hpp, e.g. `convert(par, in, out)`, which splits large inputs
+/// into chunks and runs them on the threads of a `ThreadPool`.
+//////////////////////////////////////////////////////////////////////////////
+#include "non_si.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include "trace.hpp"
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace via {
+namespace units {
+namespace detail {
+
+/// The underlying values of a span of units.
+template <typename T, Unit U>
+  requires std::same_as<T, unit_value_t<U>>
+[[nodiscard("Pure Function")]]
+auto values(std::span<const U> units) noexcept -> std::span<const T> {
+  return {reinterpret_cast<const T *>(units.data()), units.size()};
+}
+
+/// The underlying values of a mutable span of units.
+template <typename T, Unit U>
+  requires std::same_as<T, unit_value_t<U>>
+[[nodiscard("Pure Function")]]
+auto values(std::span<U> units) noexcept -> std::span<T> {
+  return {reinterpret_cast<T *>(units.data()), units.size()};
+}
+
+/// Call the batch function f(in, out) on each chunk of in and out.
+/// @pre out.size() >= in.size()
+template <ExecutionPolicy P, typename From, typename To, typename F>
+void for_each_chunk(const P &policy, std::span<const From> in,
+                    std::span<To> out, F f) {
+  assert(in.size() <= out.size());
+  for_each_chunk<typename From::value_type>(
+      policy, in.size(), [in, out, f](const std::size_t first,
+                                      const std::size_t count) {
+        f(in.subspan(first, count), out.subspan(first, count));
+      });
+}
+
+} // namespace detail
+
+/// Convert units to another unit of the same dimension, with a single
+/// multiplication of each value by `conversion_factor`,
+/// e.g. Feet to NauticalMiles.
+/// The results are bit-for-bit identical to the scalar `convert` function.
+/// @pre out.size() >= in.size()
+/// @param in the units to convert.
+/// @param out the converted units.
+template <typename To, typename From>
+  requires std::same_as<typename To::dimension, typename From::dimension> &&
+           std::same_as<typename To::value_type, typename From::value_type> &&
+           std::floating_point<typename To::value_type>
+void convert(std::span<const From> in, std::span<To> out) noexcept {
+  using T = typename To::value_type;
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("convert", in.size(), From, To);
+  simd::multiply(detail::values<T>(in), conversion_factor<To, From>,
+                 detail::values<T>(out));
+}
+
+/// Convert float units to double units of the same dimension, with a single
+/// multiplication of each value by the double `conversion_factor`,
+/// e.g. Feet<float> to Metres<double>.
+/// The results are bit-for-bit identical to converting each value to double
+/// and then calling the scalar `convert` function.
+/// @pre out.size() >= in.size()
+/// @param in the float units to convert.
+/// @param out the converted double units.
+template <typename To, typename From>
+  requires std::same_as<typename To::dimension, typename From::dimension> &&
+           std::same_as<typename From::value_type, float> &&
+           std::same_as<typename To::value_type, double>
+void convert(std::span<const From> in, std::span<To> out) noexcept {
+  using FromDouble =
+      Quantity<typename From::dimension, typename From::ratio, double>;
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("convert", in.size(), From, To);
+  simd::widen_multiply(detail::values<float>(in),
+                       conversion_factor<To, FromDouble>,
+                       detail::values<double>(out));
+}
+
+/// Convert units with 16 or 32 bit integer values to floating point units of
+/// the same dimension, e.g. FlightLevels<std::int16_t> to Metres<float>,
+/// widening each value in the SIMD registers before multiplying it by the
+/// `conversion_factor`.
+/// The results are bit-for-bit identical to the scalar `convert` function.
+/// @pre out.size() >= in.size()
+/// @param in the integer units to convert.
+/// @param out the converted floating point units.
+template <typename To, typename From>
+  requires std::same_as<typename To::dimension, typename From::dimension> &&
+           std::signed_integral<typename From::value_type> &&
+           simd::Widenable<typename From::value_type> &&
+           std::floating_point<typename To::value_type>
+void convert(std::span<const From> in, std::span<To> out) noexcept {
+  using I = typename From::value_type;
+  using T = typename To::value_type;
+  using FromFloat = Quantity<typename From::dimension, typename From::ratio, T>;
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("convert", in.size(), From, To);
+  simd::widen_multiply(detail::values<I>(in), conversion_factor<To, FromFloat>,
+                       detail::values<T>(out));
+}
+
+/// The sum of units, accumulated in double, so that the sum of many float
+/// or integer units does not lose precision.
+/// @param in the units to add.
+/// @return the sum of the units in double.
+template <typename D, typename R, typename T>
+  requires std::same_as<T, double> || simd::Widenable<T>
+[[nodiscard("Pure Function")]]
+auto sum(std::span<const Quantity<D, R, T>> in) noexcept
+    -> Quantity<D, R, double> {
+  VIA_UNITS_TRACE_CALL("sum", in.size(), Quantity<D, R, T>);
+  return Quantity<D, R, double>(simd::sum(detail::values<T>(in)));
+}
+
+/// Convert units to another unit of the same dimension, float units to
+/// double units, or integer units to floating point units, with an
+/// execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the units to convert.
+/// @param out the converted units.
+template <ExecutionPolicy P, typename To, typename From>
+  requires requires(std::span<const From> in, std::span<To> out) {
+    convert(in, out);
+  }
+void convert(const P &policy, std::span<const From> in, std::span<To> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    convert(in_chunk, out_chunk);
+  });
+}
+
+/// The sum of units, accumulated in double, with an execution policy.
+/// The sums of the chunks are added in order, so the result does not
+/// depend on the number of threads.
+/// @param policy the execution policy.
+/// @param in the units to add.
+/// @return the sum of the units in double.
+template <ExecutionPolicy P, typename D, typename R, typename T>
+  requires std::same_as<T, double> || simd::Widenable<T>
+[[nodiscard("Pure Function")]]
+auto sum(const P &policy, std::span<const Quantity<D, R, T>> in)
+    -> Quantity<D, R, double> {
+  const auto chunks{detail::chunks<T>(policy, in.size())};
+  if (chunks.count < 2)
+    return sum(in);
+
+  std::vector<double> sums(chunks.count);
+  detail::for_each_chunk<T>(
+      policy, in.size(), [&](const std::size_t first, const std::size_t count) {
+        sums[first / chunks.size] =
+            simd::sum(detail::values<T>(in.subspan(first, count)));
+      });
+  return Quantity<D, R, double>(simd::sum(std::span<const double>(sums)));
+}
+
+namespace non_si {
+
+/// Convert NauticalMiles to Metres.
+/// @pre out.size() >= in.size()
+/// @param in the NauticalMiles to convert.
+/// @param out the Metres.
+template <typename T>
+  requires std::floating_point<T>
+void to_metres(std::span<const NauticalMiles<T>> in,
+               std::span<si::Metres<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_metres", in.size(), NauticalMiles<T>,
+                       si::Metres<T>);
+  simd::multiply(detail::values<T>(in), METRES_PER_NAUTICAL_MILE<T>,
+                 detail::values<T>(out));
+}
+
+/// Convert NauticalMiles to Metres, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the NauticalMiles to convert.
+/// @param out the Metres.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_metres(const P &policy, std::span<const NauticalMiles<T>> in,
+               std::span<si::Metres<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_metres(in_chunk, out_chunk);
+  });
+}
+
+/// Convert Metres to NauticalMiles.
+/// @pre out.size() >= in.size()
+/// @param in the Metres to convert.
+/// @param out the NauticalMiles.
+template <typename T>
+  requires std::floating_point<T>
+void to_nautical_miles(std::span<const si::Metres<T>> in,
+                       std::span<NauticalMiles<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_nautical_miles", in.size(), si::Metres<T>,
+                       NauticalMiles<T>);
+  simd::divide(detail::values<T>(in), METRES_PER_NAUTICAL_MILE<T>,
+               detail::values<T>(out));
+}
+
+/// Convert Metres to NauticalMiles, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the Metres to convert.
+/// @param out the NauticalMiles.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_nautical_miles(const P &policy, std::span<const si::Metres<T>> in,
+                       std::span<NauticalMiles<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_nautical_miles(in_chunk, out_chunk);
+  });
+}
+
+/// Convert Feet to Metres.
+/// @pre out.size() >= in.size()
+/// @param in the Feet to convert.
+/// @param out the Metres.
+template <typename T>
+  requires std::floating_point<T>
+void to_metres(std::span<const Feet<T>> in,
+               std::span<si::Metres<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_metres", in.size(), Feet<T>, si::Metres<T>);
+  simd::multiply(detail::values<T>(in), METRES_PER_FOOT<T>,
+                 detail::values<T>(out));
+}
+
+/// Convert Feet to Metres, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the Feet to convert.
+/// @param out the Metres.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_metres(const P &policy, std::span<const Feet<T>> in,
+               std::span<si::Metres<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_metres(in_chunk, out_chunk);
+  });
+}
+
+/// Convert Metres to Feet.
+/// @pre out.size() >= in.size()
+/// @param in the Metres to convert.
+/// @param out the Feet.
+template <typename T>
+  requires std::floating_point<T>
+void to_feet(std::span<const si::Metres<T>> in,
+             std::span<Feet<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_feet", in.size(), si::Metres<T>, Feet<T>);
+  simd::divide(detail::values<T>(in), METRES_PER_FOOT<T>,
+               detail::values<T>(out));
+}
+
+/// Convert Metres to Feet, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the Metres to convert.
+/// @param out the Feet.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_feet(const P &policy, std::span<const si::Metres<T>> in,
+             std::span<Feet<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_feet(in_chunk, out_chunk);
+  });
+}
+
+/// Convert Knots to MetresPerSecond.
+/// @pre out.size() >= in.size()
+/// @param in the Knots to convert.
+/// @param out the MetresPerSecond.
+template <typename T>
+  requires std::floating_point<T>
+void to_metres_per_second(std::span<const Knots<T>> in,
+                          std::span<si::MetresPerSecond<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_metres_per_second", in.size(), Knots<T>,
+                       si::MetresPerSecond<T>);
+  simd::multiply(detail::values<T>(in), METRES_PER_SECOND_TO_KNOTS<T>,
+                 detail::values<T>(out));
+}
+
+/// Convert Knots to MetresPerSecond, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the Knots to convert.
+/// @param out the MetresPerSecond.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_metres_per_second(const P &policy, std::span<const Knots<T>> in,
+                          std::span<si::MetresPerSecond<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_metres_per_second(in_chunk, out_chunk);
+  });
+}
+
+/// Convert MetresPerSecond to Knots.
+/// @pre out.size() >= in.size()
+/// @param in the MetresPerSecond to convert.
+/// @param out the Knots.
+template <typename T>
+  requires std::floating_point<T>
+void to_knots(std::span<const si::MetresPerSecond<T>> in,
+              std::span<Knots<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  VIA_UNITS_TRACE_CALL("to_knots", in.size(), si::MetresPerSecond<T>,
+                       Knots<T>);
+  simd::divide(detail::values<T>(in), METRES_PER_SECOND_TO_KNOTS<T>,
+               detail::values<T>(out));
+}
+
+/// Convert MetresPerSecond to Knots, with an execution policy.
+/// @pre out.size() >= in.size()
+/// @param policy the execution policy.
+/// @param in the MetresPerSecond to convert.
+/// @param out the Knots.
+template <ExecutionPolicy P, typename T>
+  requires std::floating_point<T>
+void to_knots(const P &policy, std::span<const si::MetresPerSecond<T>> in,
+              std::span<Knots<T>> out) {
+  detail::for_each_chunk(policy, in, out, [](auto in_chunk, auto out_chunk) {
+    to_knots(in_chunk, out_chunk);
+  });
+}
+
+} // namespace non_si
+} // namespace units
+} // namespace via
@@ -0,0 +1,347 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief A delta and bit packing codec for series of units.
+///
+/// Series of altitudes, distances and speeds are smooth, so the differences
+/// between consecutive values are small. `encode` quantises each value to a
+/// whole number of quanta, e.g. 1 ft or 0.1 kt, and encodes the zigzag
+/// differences between consecutive values in blocks of `CODEC_BLOCK_SIZE`,
+/// each packed with the number of bits of its largest difference.
+/// `decode` unpacks each block with the same shifts and masks for every value,
+/// without the data dependent branches of a byte oriented varint, before
+/// summing the differences.
+///
+/// An encoded series contains an `EncodedHeader`, recording the dimension and
+/// ratio of the unit, the quantum and the number of values, followed by the
+/// blocks. Each block is a byte containing the number of bits of its values,
+/// followed by its values, packed little endian.
+/// A decoded value differs from the encoded value by at most half a quantum.
+//////////////////////////////////////////////////////////////////////////////
+#include "quantity.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace via {
+namespace units {
+
+/// The version of the codec format.
+constexpr std::uint8_t CODEC_VERSION{1};
+
+/// The number of differences in each block of an encoded series.
+constexpr std::size_t CODEC_BLOCK_SIZE{128};
+
+/// The header at the start of an encoded series.
+struct EncodedHeader {
+  /// The signature: "VIAD".
+  std::array<char, 4> magic;
+  /// The version of the format: CODEC_VERSION.
+  std::uint8_t version;
+  /// The exponents of the dimension of the unit.
+  std::int8_t length;
+  std::int8_t mass;
+  std::int8_t time;
+  std::int8_t temperature;
+  std::array<std::uint8_t, 7> reserved;
+  /// The ratio of the unit to the SI unit.
+  std::int64_t ratio_num;
+  std::int64_t ratio_den;
+  /// The quantum, in the unit.
+  double quantum;
+  /// The number of values.
+  std::uint64_t count;
+  /// The first value, in quanta.
+  std::int64_t first;
+};
+
+static_assert(sizeof(EncodedHeader) == 56 &&
+              std::is_trivially_copyable_v<EncodedHeader>);
+
+namespace detail {
+
+/// The signature at the start of an encoded series.
+constexpr std::array<char, 4> CODEC_MAGIC{'V', 'I', 'A', 'D'};
+
+/// The magnitude of a value in quanta must be less than this, so that the
+/// difference between two values does not overflow.
+constexpr double CODEC_MAX_QUANTA{0x1p62};
+
+/// The header of an encoded series of units U, without the count and first.
+template <typename U>
+constexpr auto encoded_header(const U quantum) noexcept -> EncodedHeader {
+  using D = typename U::dimension;
+  using R = typename U::ratio;
+  EncodedHeader header{};
+  header.magic = CODEC_MAGIC;
+  header.version = CODEC_VERSION;
+  header.length = static_cast<std::int8_t>(D::length);
+  header.mass = static_cast<std::int8_t>(D::mass);
+  header.time = static_cast<std::int8_t>(D::time);
+  header.temperature = static_cast<std::int8_t>(D::temperature);
+  header.ratio_num = R::num;
+  header.ratio_den = R::den;
+  header.quantum = static_cast<double>(quantum.v());
+  return header;
+}
+
+/// Whether a header records the unit of units U.
+template <typename U>
+constexpr auto is_encoding_of(const EncodedHeader &header) noexcept -> bool {
+  constexpr auto expected{encoded_header(U(1))};
+  return header.length == expected.length && header.mass == expected.mass &&
+         header.time == expected.time &&
+         header.temperature == expected.temperature &&
+         header.ratio_num == expected.ratio_num &&
+         header.ratio_den == expected.ratio_den;
+}
+
+/// Map a signed difference to an unsigned value, so that small negative
+/// differences have few bits: 0, -1, 1, -2... map to 0, 1, 2, 3...
+constexpr auto zigzag(const std::int64_t value) noexcept -> std::uint64_t {
+  return (static_cast<std::uint64_t>(value) << 1) ^
+         static_cast<std::uint64_t>(value >> 63);
+}
+
+/// The inverse of `zigzag`.
+constexpr auto unzigzag(const std::uint64_t value) noexcept -> std::int64_t {
+  return static_cast<std::int64_t>((value >> 1) ^ (0 - (value & 1)));
+}
+
+/// The number of bytes of size values of width bits.
+constexpr auto packed_size(const std::size_t size,
+                           const std::size_t width) noexcept -> std::size_t {
+  return (size * width + 7) / 8;
+}
+
+/// A block of packed values, with 9 bytes of padding so that every value
+/// can be read or written with an unaligned 8 byte access and a byte.
+using PackedBlock = std::array<std::byte, CODEC_BLOCK_SIZE * 8 + 9>;
+
+/// Pack values of width bits into a zeroed block.
+/// @param values the values, each less than 2^width.
+/// @param width the number of bits of each value: 0 to 64.
+/// @param block the zeroed block.
+inline void pack(const std::span<const std::uint64_t> values,
+                 const unsigned width, PackedBlock &block) noexcept {
+  for (std::size_t i{0}; i < values.size(); ++i) {
+    const auto bit{i * width};
+    const auto shift{static_cast<unsigned>(bit % 8)};
+    std::byte *const p{block.data() + bit / 8};
+    std::uint64_t low;
+    std::memcpy(&low, p, sizeof(low));
+    low |= values[i] << shift;
+    std::memcpy(p, &low, sizeof(low));
+    // The bits shifted out of the low 8 bytes, if any.
+    p[8] |= static_cast<std::byte>((values[i] >> 1) >> (63 - shift));
+  }
+}
+
+/// Unpack values of width bits from a block.
+/// @param block the block, zero padded after the packed values.
+/// @param width the number of bits of each value: 0 to 64.
+/// @param values the values.
+inline void unpack(const PackedBlock &block, const unsigned width,
+                   const std::span<std::uint64_t> values) noexcept {
+  const std::uint64_t mask{width < 64 ? (std::uint64_t(1) << width) - 1
+                                      : ~std::uint64_t(0)};
+  for (std::size_t i{0}; i < values.size(); ++i) {
+    const auto bit{i * width};
+    const auto shift{static_cast<unsigned>(bit % 8)};
+    const std::byte *const p{block.data() + bit / 8};
+    std::uint64_t low;
+    std::memcpy(&low, p, sizeof(low));
+    const auto high{std::to_integer<std::uint64_t>(p[8])};
+    values[i] = ((low >> shift) | ((high << 1) << (63 - shift))) & mask;
+  }
+}
+
+/// Read the header of an encoded series of units U.
+/// @param bytes the encoded series.
+/// @return the header or the error.
+template <typename U>
+auto read_header(const std::span<const std::byte> bytes)
+    -> std::expected<EncodedHeader, std::errc> {
+  if constexpr (std::endian::native != std::endian::little)
+    return std::unexpected(std::errc::not_supported);
+
+  EncodedHeader header;
+  if (bytes.size() < sizeof(header))
+    return std::unexpected(std::errc::illegal_byte_sequence);
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != CODEC_MAGIC || !(header.quantum > 0.0) ||
+      !std::isfinite(header.quantum))
+    return std::unexpected(std::errc::illegal_byte_sequence);
+  if (header.version != CODEC_VERSION)
+    return std::unexpected(std::errc::not_supported);
+  if (!is_encoding_of<U>(header))
+    return std::unexpected(std::errc::invalid_argument);
+  return header;
+}
+
+} // namespace detail
+
+/// Encode a series of units, appending it to bytes.
+/// @param units the units.
+/// @param quantum the quantum of the encoded values, e.g. `Feet<double>(1)`.
+/// @param bytes the bytes to append the encoded series to.
+/// @return std::errc() on success, std::errc::invalid_argument if the
+/// quantum is not positive and finite or a value is not finite or at least
+/// 2^62 quanta, or std::errc::not_supported on a big endian platform.
+/// On error, bytes is unchanged.
+template <typename U>
+  requires Unit<U> && std::floating_point<unit_value_t<U>>
+auto encode(const std::type_identity_t<std::span<const U>> units,
+            const U quantum, std::vector<std::byte> &bytes) -> std::errc {
+  if constexpr (std::endian::native != std::endian::little)
+    return std::errc::not_supported;
+
+  const auto q{static_cast<double>(quantum.v())};
+  if (!(q > 0.0) || !std::isfinite(q))
+    return std::errc::invalid_argument;
+
+  // Returns false if the value is not finite or too large.
+  const auto quantise{[q](const U unit, std::int64_t &value) {
+    const auto quanta{std::round(static_cast<double>(unit.v()) / q)};
+    if (!(std::abs(quanta) < detail::CODEC_MAX_QUANTA))
+      return false;
+    value = static_cast<std::int64_t>(quanta);
+    return true;
+  }};
+
+  auto header{detail::encoded_header(quantum)};
+  header.count = units.size();
+  if (!units.empty() && !quantise(units.front(), header.first))
+    return std::errc::invalid_argument;
+
+  const auto initial_size{bytes.size()};
+  const auto *const h{reinterpret_cast<const std::byte *>(&header)};
+  bytes.insert(bytes.end(), h, h + sizeof(header));
+
+  std::array<std::uint64_t, CODEC_BLOCK_SIZE> differences;
+  auto previous{header.first};
+  for (std::size_t first{1}; first < units.size();
+       first += CODEC_BLOCK_SIZE) {
+    const auto size{std::min(CODEC_BLOCK_SIZE, units.size() - first)};
+    std::uint64_t bits{0};
+    for (std::size_t i{0}; i < size; ++i) {
+      std::int64_t value;
+      if (!quantise(units[first + i], value)) {
+        bytes.resize(initial_size);
+        return std::errc::invalid_argument;
+      }
+      differences[i] = detail::zigzag(value - previous);
+      bits |= differences[i];
+      previous = value;
+    }
+
+    const auto width{static_cast<unsigned>(std::bit_width(bits))};
+    detail::PackedBlock block{};
+    detail::pack(std::span(differences.data(), size), width, block);
+    bytes.push_back(static_cast<std::byte>(width));
+    bytes.insert(bytes.end(), block.begin(),
+                 block.begin() + static_cast<std::ptrdiff_t>(
+                                     detail::packed_size(size, width)));
+  }
+  return std::errc();
+}
+
+/// The number of units in an encoded series of units U.
+/// @param bytes the encoded series.
+/// @return the number of units or the error of reading the header: see
+/// `decode`.
+template <typename U>
+  requires Unit<U> && std::floating_point<unit_value_t<U>>
+auto decoded_size(const std::span<const std::byte> bytes)
+    -> std::expected<std::size_t, std::errc> {
+  const auto header{detail::read_header<U>(bytes)};
+  if (!header)
+    return std::unexpected(header.error());
+  return static_cast<std::size_t>(header->count);
+}
+
+/// Decode an encoded series of units U.
+/// @param bytes the encoded series, which may be followed by other data.
+/// @param units the decoded units: at least `decoded_size` units.
+/// @return the number of bytes of the encoded series or the error:
+/// std::errc::illegal_byte_sequence if it is not a valid encoded series,
+/// std::errc::not_supported if it is a different version or the platform
+/// is big endian, or std::errc::invalid_argument if it is not a series of
+/// the unit of U or units is too small.
+template <typename U>
+  requires Unit<U> && std::floating_point<unit_value_t<U>>
+auto decode(const std::span<const std::byte> bytes, const std::span<U> units)
+    -> std::expected<std::size_t, std::errc> {
+  using T = typename U::value_type;
+  const auto header{detail::read_header<U>(bytes)};
+  if (!header)
+    return std::unexpected(header.error());
+  if (header->count > units.size())
+    return std::unexpected(std::errc::invalid_argument);
+
+  const auto count{static_cast<std::size_t>(header->count)};
+  const auto quantum{header->quantum};
+  if (count > 0)
+    units[0] = U(static_cast<T>(static_cast<double>(header->first) * quantum));
+
+  std::size_t offset{sizeof(EncodedHeader)};
+  std::array<std::uint64_t, CODEC_BLOCK_SIZE> differences;
+  auto value{static_cast<std::uint64_t>(header->first)};
+  for (std::size_t first{1}; first < count; first += CODEC_BLOCK_SIZE) {
+    const auto size{std::min(CODEC_BLOCK_SIZE, count - first)};
+    if (offset >= bytes.size())
+      return std::unexpected(std::errc::illegal_byte_sequence);
+    const auto width{std::to_integer<unsigned>(bytes[offset++])};
+    const auto packed{detail::packed_size(size, width)};
+    if (width > 64 || packed > bytes.size() - offset)
+      return std::unexpected(std::errc::illegal_byte_sequence);
+
+    detail::PackedBlock block;
+    std::memcpy(block.data(), bytes.data() + offset, packed);
+    std::fill_n(block.begin() + static_cast<std::ptrdiff_t>(packed), 9,
+                std::byte{0});
+    offset += packed;
+    detail::unpack(block, width, std::span(differences.data(), size));
+
+    // Unsigned arithmetic, so that a corrupt series cannot overflow.
+    for (std::size_t i{0}; i < size; ++i) {
+      value += static_cast<std::uint64_t>(detail::unzigzag(differences[i]));
+      units[first + i] = U(static_cast<T>(
+          static_cast<double>(static_cast<std::int64_t>(value)) * quantum));
+    }
+  }
+  return offset;
+}
+
+} // namespace units
+} // namespace via
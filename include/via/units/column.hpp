@@ -0,0 +1,424 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Structure of arrays containers for columns of units.
+///
+/// A `UnitColumn` stores units contiguously in storage aligned to a 64 byte
+/// cache line, allocated from a `std::pmr::memory_resource`, e.g. a
+/// `std::pmr::monotonic_buffer_resource` arena for a batch of flights.
+/// A `UnitTable` stores a row of units as a `UnitColumn` of each unit type,
+/// with all of the columns allocated from the same memory resource.
+///
+/// Units are trivially copyable, so the columns grow without initialising
+/// their new elements and relocate their elements with `std::memcpy`.
+/// A `UnitTable` allocates the storage of every column before it changes
+/// any of them, so a failed allocation leaves the table unchanged.
+/// The columns provide spans of the units, for the batch conversions in
+/// batch.hpp, and spans of their values, for the SIMD kernels in simd.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "quantity.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace via {
+namespace units {
+
+/// The alignment of the storage of a `UnitColumn`: a cache line, which is
+/// also the size of an AVX-512 register.
+constexpr std::size_t COLUMN_ALIGNMENT{64};
+
+/// A unit that may be stored in a `UnitColumn`: any `Unit`, since units
+/// are trivially copyable with the size and layout of their value.
+template <typename U>
+concept ColumnUnit = Unit<U> && std::is_trivially_destructible_v<U>;
+
+/// A column of units in contiguous, 64 byte aligned storage, allocated from
+/// a `std::pmr::memory_resource`.
+/// Like the `std::pmr` containers, a copy uses the default memory resource
+/// and a move keeps the memory resource of the moved column.
+template <typename U>
+  requires ColumnUnit<U>
+class UnitColumn final {
+  U *data_{nullptr};
+  std::size_t size_{0};
+  std::size_t capacity_{0};
+  std::pmr::memory_resource *resource_;
+
+  /// The minimum capacity of a column: a cache line of units.
+  static constexpr std::size_t MINIMUM_CAPACITY{COLUMN_ALIGNMENT / sizeof(U)};
+
+  /// Move the units to new storage with the given capacity.
+  void reallocate(const std::size_t capacity) {
+    auto *data{static_cast<U *>(
+        resource_->allocate(capacity * sizeof(U), COLUMN_ALIGNMENT))};
+    if (size_ > 0)
+      std::memcpy(data, data_, size_ * sizeof(U));
+    deallocate();
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  /// Return the storage to the memory resource.
+  void deallocate() noexcept {
+    if (data_)
+      resource_->deallocate(data_, capacity_ * sizeof(U), COLUMN_ALIGNMENT);
+  }
+
+public:
+  using value_type = U;
+  using size_type = std::size_t;
+  using iterator = U *;
+  using const_iterator = const U *;
+  using allocator_type = std::pmr::polymorphic_allocator<U>;
+
+  /// Default constructor: an empty column using the default memory resource.
+  UnitColumn() noexcept : resource_{std::pmr::get_default_resource()} {}
+
+  /// Constructor: an empty column using the memory resource.
+  /// @param resource the memory resource for the storage.
+  explicit UnitColumn(std::pmr::memory_resource *resource) noexcept
+      : resource_{resource} {
+    assert(resource);
+  }
+
+  /// Constructor: a column of size uninitialised units.
+  /// @param size the number of units.
+  /// @param resource the memory resource for the storage.
+  explicit UnitColumn(
+      const size_type size,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : UnitColumn(resource) {
+    resize_for_overwrite(size);
+  }
+
+  /// Constructor: a column of copies of the units.
+  /// @param units the units to copy.
+  /// @param resource the memory resource for the storage.
+  explicit UnitColumn(
+      const std::span<const U> units,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : UnitColumn(resource) {
+    assign(units);
+  }
+
+  /// Copy constructor: the copy uses the default memory resource.
+  UnitColumn(const UnitColumn &other)
+      : UnitColumn(other.units(), std::pmr::get_default_resource()) {}
+
+  /// Copy constructor with a memory resource.
+  UnitColumn(const UnitColumn &other, std::pmr::memory_resource *resource)
+      : UnitColumn(other.units(), resource) {}
+
+  /// Move constructor: the column takes the storage and the memory resource.
+  UnitColumn(UnitColumn &&other) noexcept
+      : data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0)},
+        capacity_{std::exchange(other.capacity_, 0)},
+        resource_{other.resource_} {}
+
+  /// Copy assignment: the column keeps its memory resource.
+  auto operator=(const UnitColumn &other) -> UnitColumn & {
+    if (this != &other)
+      assign(other.units());
+    return *this;
+  }
+
+  /// Move assignment: the column keeps its memory resource, so it only takes
+  /// the storage of a column with an equal memory resource.
+  auto operator=(UnitColumn &&other) -> UnitColumn & {
+    if (this != &other) {
+      if (*resource_ == *other.resource_) {
+        deallocate();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+      } else
+        assign(other.units());
+    }
+    return *this;
+  }
+
+  /// Destructor
+  ~UnitColumn() { deallocate(); }
+
+  /// The memory resource of the storage.
+  [[nodiscard]]
+  auto resource() const noexcept -> std::pmr::memory_resource * {
+    return resource_;
+  }
+
+  /// A polymorphic allocator using the memory resource of the storage.
+  [[nodiscard]]
+  auto get_allocator() const noexcept -> allocator_type {
+    return allocator_type(resource_);
+  }
+
+  /// The number of units in the column.
+  [[nodiscard]]
+  auto size() const noexcept -> size_type {
+    return size_;
+  }
+
+  /// The number of units that the column can hold without reallocating.
+  [[nodiscard]]
+  auto capacity() const noexcept -> size_type {
+    return capacity_;
+  }
+
+  /// Whether the column is empty.
+  [[nodiscard]]
+  auto empty() const noexcept -> bool {
+    return size_ == 0;
+  }
+
+  /// The units, aligned to `COLUMN_ALIGNMENT` if the column is not empty.
+  [[nodiscard]]
+  auto data() noexcept -> U * {
+    return data_;
+  }
+
+  /// The units, aligned to `COLUMN_ALIGNMENT` if the column is not empty.
+  [[nodiscard]]
+  auto data() const noexcept -> const U * {
+    return data_;
+  }
+
+  /// A span of the units.
+  [[nodiscard]]
+  auto units() noexcept -> std::span<U> {
+    return {data_, size_};
+  }
+
+  /// A span of the units.
+  [[nodiscard]]
+  auto units() const noexcept -> std::span<const U> {
+    return {data_, size_};
+  }
+
+  /// A span of the values of the units, e.g. for the SIMD kernels.
+  [[nodiscard]]
+  auto values() noexcept -> std::span<typename U::value_type> {
+    return {reinterpret_cast<typename U::value_type *>(data_), size_};
+  }
+
+  /// A span of the values of the units, e.g. for the SIMD kernels.
+  [[nodiscard]]
+  auto values() const noexcept -> std::span<const typename U::value_type> {
+    return {reinterpret_cast<const typename U::value_type *>(data_), size_};
+  }
+
+  /// The unit at index.
+  /// @pre index < size()
+  [[nodiscard]]
+  auto operator[](const size_type index) noexcept -> U & {
+    assert(index < size_);
+    return data_[index];
+  }
+
+  /// The unit at index.
+  /// @pre index < size()
+  [[nodiscard]]
+  auto operator[](const size_type index) const noexcept -> const U & {
+    assert(index < size_);
+    return data_[index];
+  }
+
+  [[nodiscard]] auto begin() noexcept -> iterator { return data_; }
+  [[nodiscard]] auto end() noexcept -> iterator { return data_ + size_; }
+  [[nodiscard]] auto begin() const noexcept -> const_iterator { return data_; }
+  [[nodiscard]] auto end() const noexcept -> const_iterator {
+    return data_ + size_;
+  }
+
+  /// Ensure that the column can hold capacity units without reallocating.
+  /// @param capacity the number of units.
+  void reserve(const size_type capacity) {
+    if (capacity > capacity_)
+      reallocate(std::max(capacity, MINIMUM_CAPACITY));
+  }
+
+  /// Resize the column without initialising any new units, so that they
+  /// may be overwritten, e.g. by a batch conversion.
+  /// @param size the number of units.
+  void resize_for_overwrite(const size_type size) {
+    reserve(size);
+    size_ = size;
+  }
+
+  /// Append a unit, doubling the capacity of the column if it is full.
+  /// @param unit the unit to append.
+  void push_back(const U unit) {
+    if (size_ == capacity_)
+      reallocate(std::max(2 * capacity_, MINIMUM_CAPACITY));
+    data_[size_++] = unit;
+  }
+
+  /// Replace the units of the column with copies of units.
+  /// The units may be in the column, e.g. a subspan of `units()`.
+  /// @param units the units to copy.
+  void assign(const std::span<const U> units) {
+    if (units.size() > capacity_) {
+      size_ = 0;
+      reserve(units.size());
+    }
+    if (!units.empty())
+      std::memmove(data_, units.data(), units.size() * sizeof(U));
+    size_ = units.size();
+  }
+
+  /// Remove all the units, keeping the storage.
+  void clear() noexcept { size_ = 0; }
+};
+
+/// A table of rows of units, stored as a `UnitColumn` of each unit type,
+/// with all of the columns allocated from the same memory resource.
+/// The unit types need not be unique, e.g. a trajectory may have columns of
+/// `Metres` for both the distance flown and the altitude.
+template <typename... Us>
+  requires(sizeof...(Us) > 0 && (ColumnUnit<Us> && ...))
+class UnitTable final {
+  std::tuple<UnitColumn<Us>...> columns_;
+
+public:
+  using size_type = std::size_t;
+
+  /// The number of columns.
+  static constexpr std::size_t COLUMNS{sizeof...(Us)};
+
+  /// The unit type of column I.
+  template <std::size_t I>
+  using unit_type = std::tuple_element_t<I, std::tuple<Us...>>;
+
+  /// Default constructor: an empty table using the default memory resource.
+  UnitTable() noexcept = default;
+
+  /// Constructor: an empty table using the memory resource.
+  /// @param resource the memory resource for the columns.
+  explicit UnitTable(std::pmr::memory_resource *resource) noexcept
+      : columns_{UnitColumn<Us>(resource)...} {}
+
+  /// Constructor: a table of size rows of uninitialised units.
+  /// @param size the number of rows.
+  /// @param resource the memory resource for the columns.
+  explicit UnitTable(
+      const size_type size,
+      std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+      : columns_{UnitColumn<Us>(size, resource)...} {}
+
+  /// The memory resource of the columns.
+  [[nodiscard]]
+  auto resource() const noexcept -> std::pmr::memory_resource * {
+    return std::get<0>(columns_).resource();
+  }
+
+  /// The number of rows in the table.
+  [[nodiscard]]
+  auto size() const noexcept -> size_type {
+    return std::get<0>(columns_).size();
+  }
+
+  /// Whether the table is empty.
+  [[nodiscard]]
+  auto empty() const noexcept -> bool {
+    return size() == 0;
+  }
+
+  /// Column I of the table.
+  template <std::size_t I>
+  [[nodiscard]]
+  auto column() noexcept -> UnitColumn<unit_type<I>> & {
+    return std::get<I>(columns_);
+  }
+
+  /// Column I of the table.
+  template <std::size_t I>
+  [[nodiscard]]
+  auto column() const noexcept -> const UnitColumn<unit_type<I>> & {
+    return std::get<I>(columns_);
+  }
+
+  /// The column of units U, if there is only one column of U in the table.
+  template <typename U>
+  [[nodiscard]]
+  auto column() noexcept -> UnitColumn<U> & {
+    return std::get<UnitColumn<U>>(columns_);
+  }
+
+  /// The column of units U, if there is only one column of U in the table.
+  template <typename U>
+  [[nodiscard]]
+  auto column() const noexcept -> const UnitColumn<U> & {
+    return std::get<UnitColumn<U>>(columns_);
+  }
+
+  /// Ensure that every column can hold capacity rows without reallocating.
+  /// @param capacity the number of rows.
+  void reserve(const size_type capacity) {
+    std::apply(
+        [capacity](auto &...columns) { (columns.reserve(capacity), ...); },
+        columns_);
+  }
+
+  /// Resize every column without initialising any new units.
+  /// @param size the number of rows.
+  void resize_for_overwrite(const size_type size) {
+    reserve(size);
+    std::apply(
+        [size](auto &...columns) { (columns.resize_for_overwrite(size), ...); },
+        columns_);
+  }
+
+  /// Append a row of units.
+  /// Every full column doubles its capacity before any unit is appended.
+  /// @param units the units of the row, one for each column.
+  void push_back(const Us... units) {
+    std::apply(
+        [](auto &...columns) {
+          const auto grow{[](auto &column) {
+            if (column.size() == column.capacity())
+              column.reserve(std::max<size_type>(2 * column.capacity(), 1));
+          }};
+          (grow(columns), ...);
+        },
+        columns_);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (std::get<Is>(columns_).push_back(units), ...);
+    }(std::index_sequence_for<Us...>{});
+  }
+
+  /// Remove all the rows, keeping the storage.
+  void clear() noexcept {
+    std::apply([](auto &...columns) { (columns.clear(), ...); }, columns_);
+  }
+};
+
+} // namespace units
+} // namespace via
@@ -0,0 +1,470 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief A versioned binary columnar file format for columns of units.
+///
+/// A file contains a 64 byte file header, a 64 byte column header for each
+/// column and the values of each column, starting at a 64 byte aligned
+/// offset. Each column header records the name of the column, the dimension
+/// and ratio of its unit, e.g. Feet, and the size of its values, float or
+/// double. All integers and values are little endian.
+///
+/// `write_columns` writes columns of units to a file.
+/// `MappedColumns` maps a file read-only into memory and provides spans of
+/// the units of its columns, without copying or parsing the values.
+/// The unit types of the columns are checked when the file is opened, so a
+/// file of Metres cannot be read as Feet, or a file of floats as doubles.
+//////////////////////////////////////////////////////////////////////////////
+#include "quantity.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace via {
+namespace units {
+
+/// The version of the columnar file format.
+constexpr std::uint32_t COLUMNAR_VERSION{1};
+
+/// The alignment of the headers and column values in a columnar file.
+constexpr std::size_t COLUMNAR_ALIGNMENT{64};
+
+/// The maximum length of the name of a column in a columnar file.
+constexpr std::size_t COLUMN_NAME_MAX_SIZE{32};
+
+/// The header at the start of a columnar file.
+struct ColumnarFileHeader {
+  /// The file signature: "VIAUNITS".
+  std::array<char, 8> magic;
+  /// The version of the file format: COLUMNAR_VERSION.
+  std::uint32_t version;
+  /// The number of columns.
+  std::uint32_t column_count;
+  /// The number of values in each column.
+  std::uint64_t row_count;
+  std::array<std::uint8_t, 40> reserved;
+};
+
+/// The header of a column in a columnar file.
+struct ColumnarColumnHeader {
+  /// The name of the column, padded with zeros.
+  std::array<char, COLUMN_NAME_MAX_SIZE> name;
+  /// The exponents of the dimension of the unit.
+  std::int8_t length;
+  std::int8_t mass;
+  std::int8_t time;
+  std::int8_t temperature;
+  /// The size of each value in bytes: 4 for float, 8 for double.
+  std::uint8_t value_size;
+  std::array<std::uint8_t, 3> reserved;
+  /// The ratio of the unit to the SI unit.
+  std::int64_t ratio_num;
+  std::int64_t ratio_den;
+  /// The offset of the values of the column from the start of the file.
+  std::uint64_t offset;
+};
+
+static_assert(sizeof(ColumnarFileHeader) == COLUMNAR_ALIGNMENT &&
+              std::is_trivially_copyable_v<ColumnarFileHeader>);
+static_assert(sizeof(ColumnarColumnHeader) == COLUMNAR_ALIGNMENT &&
+              std::is_trivially_copyable_v<ColumnarColumnHeader>);
+
+/// A named column of units to write to a columnar file.
+template <typename U> struct NamedColumn {
+  /// The name of the column, at most COLUMN_NAME_MAX_SIZE characters.
+  std::string_view name;
+  /// The units of the column.
+  std::span<const U> units;
+};
+
+namespace detail {
+
+/// The signature at the start of a columnar file.
+constexpr std::array<char, 8> COLUMNAR_MAGIC{'V', 'I', 'A', 'U',
+                                             'N', 'I', 'T', 'S'};
+
+/// Round size up to a multiple of COLUMNAR_ALIGNMENT.
+constexpr auto columnar_align(const std::uint64_t size) noexcept
+    -> std::uint64_t {
+  return (size + COLUMNAR_ALIGNMENT - 1) & ~(COLUMNAR_ALIGNMENT - 1);
+}
+
+/// The column header for units U, without the name and offset.
+template <typename U>
+constexpr auto column_header() noexcept -> ColumnarColumnHeader {
+  using D = typename U::dimension;
+  using R = typename U::ratio;
+  ColumnarColumnHeader header{};
+  header.length = static_cast<std::int8_t>(D::length);
+  header.mass = static_cast<std::int8_t>(D::mass);
+  header.time = static_cast<std::int8_t>(D::time);
+  header.temperature = static_cast<std::int8_t>(D::temperature);
+  header.value_size = static_cast<std::uint8_t>(sizeof(typename U::value_type));
+  header.ratio_num = R::num;
+  header.ratio_den = R::den;
+  return header;
+}
+
+/// Whether a column header records the units U.
+template <typename U>
+constexpr auto is_column_of(const ColumnarColumnHeader &header) noexcept
+    -> bool {
+  constexpr auto expected{column_header<U>()};
+  return header.length == expected.length && header.mass == expected.mass &&
+         header.time == expected.time &&
+         header.temperature == expected.temperature &&
+         header.value_size == expected.value_size &&
+         header.ratio_num == expected.ratio_num &&
+         header.ratio_den == expected.ratio_den;
+}
+
+/// A file mapped read-only into memory.
+class MappedFile final {
+  const std::byte *data_{nullptr};
+  std::size_t size_{0};
+
+  MappedFile(const void *data, const std::size_t size) noexcept
+      : data_{static_cast<const std::byte *>(data)}, size_{size} {}
+
+  void unmap() noexcept {
+    if (data_) {
+#ifdef _WIN32
+      ::UnmapViewOfFile(data_);
+#else
+      ::munmap(const_cast<std::byte *>(data_), size_);
+#endif
+    }
+  }
+
+public:
+  MappedFile() noexcept = default;
+
+  MappedFile(MappedFile &&other) noexcept
+      : data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0)} {}
+
+  auto operator=(MappedFile &&other) noexcept -> MappedFile & {
+    if (this != &other) {
+      unmap();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  auto operator=(const MappedFile &) -> MappedFile & = delete;
+
+  ~MappedFile() { unmap(); }
+
+  /// The contents of the file.
+  [[nodiscard]]
+  auto bytes() const noexcept -> std::span<const std::byte> {
+    return {data_, size_};
+  }
+
+  /// Map a file read-only into memory.
+  /// An empty file is not mapped.
+  /// @param path the path of the file.
+  /// @return the mapped file or the error.
+  static auto open(const std::filesystem::path &path)
+      -> std::expected<MappedFile, std::errc> {
+#ifdef _WIN32
+    const auto error{[] {
+      switch (::GetLastError()) {
+      case ERROR_FILE_NOT_FOUND:
+      case ERROR_PATH_NOT_FOUND:
+        return std::errc::no_such_file_or_directory;
+      case ERROR_ACCESS_DENIED:
+        return std::errc::permission_denied;
+      case ERROR_NOT_ENOUGH_MEMORY:
+        return std::errc::not_enough_memory;
+      default:
+        return std::errc::io_error;
+      }
+    }};
+
+    const HANDLE file{::CreateFileW(path.c_str(), GENERIC_READ,
+                                    FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE)
+      return std::unexpected(error());
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+      const auto ec{error()};
+      ::CloseHandle(file);
+      return std::unexpected(ec);
+    }
+    if (size.QuadPart == 0) {
+      ::CloseHandle(file);
+      return MappedFile();
+    }
+
+    const HANDLE mapping{
+        ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+    const auto mapping_error{mapping ? std::errc() : error()};
+    ::CloseHandle(file);
+    if (!mapping)
+      return std::unexpected(mapping_error);
+
+    const void *data{::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)};
+    const auto view_error{data ? std::errc() : error()};
+    ::CloseHandle(mapping);
+    if (!data)
+      return std::unexpected(view_error);
+    return MappedFile(data, static_cast<std::size_t>(size.QuadPart));
+#else
+    const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fd < 0)
+      return std::unexpected(std::errc(errno));
+
+    struct stat status{};
+    if (::fstat(fd, &status) != 0) {
+      const auto ec{std::errc(errno)};
+      ::close(fd);
+      return std::unexpected(ec);
+    }
+    const auto size{static_cast<std::size_t>(status.st_size)};
+    if (size == 0) {
+      ::close(fd);
+      return MappedFile();
+    }
+
+    void *data{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)};
+    const auto ec{data == MAP_FAILED ? std::errc(errno) : std::errc()};
+    ::close(fd);
+    if (data == MAP_FAILED)
+      return std::unexpected(ec);
+    return MappedFile(data, size);
+#endif
+  }
+};
+
+} // namespace detail
+
+/// Write columns of units to a columnar file, replacing any existing file.
+/// @param path the path of the file.
+/// @param columns the named columns of units, all of the same size.
+/// @return std::errc() on success, std::errc::invalid_argument if the
+/// columns are of different sizes or a name is longer than
+/// COLUMN_NAME_MAX_SIZE, std::errc::not_supported on a big endian platform,
+/// otherwise std::errc::io_error.
+template <typename... Us>
+  requires(sizeof...(Us) > 0 &&
+           ((Unit<Us> && std::floating_point<unit_value_t<Us>>) && ...))
+auto write_columns(const std::filesystem::path &path,
+                   const NamedColumn<Us> &...columns) -> std::errc {
+  if constexpr (std::endian::native != std::endian::little)
+    return std::errc::not_supported;
+
+  const std::size_t rows{std::get<0>(std::tie(columns...)).units.size()};
+  if (((columns.units.size() != rows) || ...) ||
+      ((columns.name.size() > COLUMN_NAME_MAX_SIZE) || ...))
+    return std::errc::invalid_argument;
+
+  ColumnarFileHeader file_header{};
+  file_header.magic = detail::COLUMNAR_MAGIC;
+  file_header.version = COLUMNAR_VERSION;
+  file_header.column_count = sizeof...(Us);
+  file_header.row_count = rows;
+
+  std::array<ColumnarColumnHeader, sizeof...(Us)> headers{
+      detail::column_header<Us>()...};
+  std::uint64_t offset{sizeof(ColumnarFileHeader) +
+                       sizeof(ColumnarColumnHeader) * sizeof...(Us)};
+  std::size_t i{0};
+  (
+      [&] {
+        std::memcpy(headers[i].name.data(), columns.name.data(),
+                    columns.name.size());
+        headers[i++].offset = offset;
+        offset = detail::columnar_align(offset + columns.units.size_bytes());
+      }(),
+      ...);
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char *>(&file_header),
+             sizeof(file_header));
+  file.write(reinterpret_cast<const char *>(headers.data()),
+             sizeof(ColumnarColumnHeader) * headers.size());
+
+  constexpr std::array<char, COLUMNAR_ALIGNMENT> padding{};
+  (
+      [&] {
+        const auto bytes{columns.units.size_bytes()};
+        file.write(reinterpret_cast<const char *>(columns.units.data()),
+                   static_cast<std::streamsize>(bytes));
+        file.write(padding.data(), static_cast<std::streamsize>(
+                                       detail::columnar_align(bytes) - bytes));
+      }(),
+      ...);
+
+  file.close();
+  return file ? std::errc() : std::errc::io_error;
+}
+
+/// The columns of units Us of a columnar file, mapped read-only into memory.
+/// The spans of the columns refer to the mapped file, so they are only
+/// valid while the MappedColumns exists.
+template <typename... Us>
+  requires(sizeof...(Us) > 0 &&
+           ((Unit<Us> && std::floating_point<unit_value_t<Us>>) && ...))
+class MappedColumns final {
+  detail::MappedFile file_;
+  std::size_t rows_{0};
+  std::array<const ColumnarColumnHeader *, sizeof...(Us)> headers_{};
+
+  explicit MappedColumns(detail::MappedFile &&file) noexcept
+      : file_{std::move(file)} {}
+
+public:
+  /// The unit type of column I.
+  template <std::size_t I>
+  using unit_type = std::tuple_element_t<I, std::tuple<Us...>>;
+
+  /// Open a columnar file of columns of units Us.
+  /// @param path the path of the file.
+  /// @return the mapped columns or the error: the error of opening the file,
+  /// std::errc::illegal_byte_sequence if it is not a valid columnar file,
+  /// std::errc::not_supported if it is a different version or the platform
+  /// is big endian, or std::errc::invalid_argument if the columns are not
+  /// the units Us.
+  static auto open(const std::filesystem::path &path)
+      -> std::expected<MappedColumns, std::errc> {
+    if constexpr (std::endian::native != std::endian::little)
+      return std::unexpected(std::errc::not_supported);
+
+    auto file{detail::MappedFile::open(path)};
+    if (!file)
+      return std::unexpected(file.error());
+
+    const auto bytes{file->bytes()};
+    ColumnarFileHeader file_header;
+    if (bytes.size() < sizeof(file_header))
+      return std::unexpected(std::errc::illegal_byte_sequence);
+    std::memcpy(&file_header, bytes.data(), sizeof(file_header));
+    if (file_header.magic != detail::COLUMNAR_MAGIC)
+      return std::unexpected(std::errc::illegal_byte_sequence);
+    if (file_header.version != COLUMNAR_VERSION)
+      return std::unexpected(std::errc::not_supported);
+    if (file_header.column_count != sizeof...(Us))
+      return std::unexpected(std::errc::invalid_argument);
+    if (bytes.size() < sizeof(file_header) + sizeof(ColumnarColumnHeader) *
+                                                 sizeof...(Us))
+      return std::unexpected(std::errc::illegal_byte_sequence);
+
+    // The headers are 64 byte aligned in the page aligned mapping.
+    MappedColumns columns(std::move(*file));
+    columns.rows_ = static_cast<std::size_t>(file_header.row_count);
+    const auto *headers{reinterpret_cast<const ColumnarColumnHeader *>(
+        bytes.data() + sizeof(file_header))};
+    std::size_t i{0};
+    const bool valid{(
+        [&] {
+          const auto &header{headers[i]};
+          columns.headers_[i++] = &header;
+          return detail::is_column_of<Us>(header);
+        }() &&
+        ...)};
+    if (!valid)
+      return std::unexpected(std::errc::invalid_argument);
+
+    for (const auto *header : columns.headers_)
+      if (header->offset % COLUMNAR_ALIGNMENT != 0 ||
+          header->offset > bytes.size() ||
+          file_header.row_count >
+              (bytes.size() - header->offset) / header->value_size)
+        return std::unexpected(std::errc::illegal_byte_sequence);
+
+    return columns;
+  }
+
+  /// The number of values in each column.
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return rows_;
+  }
+
+  /// The name of column I.
+  template <std::size_t I>
+  [[nodiscard]]
+  auto name() const noexcept -> std::string_view {
+    const auto &name{std::get<I>(headers_)->name};
+    const std::string_view padded(name.data(), name.size());
+    return padded.substr(0, padded.find('\0'));
+  }
+
+  /// The units of column I, in the mapped file.
+  template <std::size_t I>
+  [[nodiscard]]
+  auto column() const noexcept -> std::span<const unit_type<I>> {
+    return {reinterpret_cast<const unit_type<I> *>(
+                file_.bytes().data() + std::get<I>(headers_)->offset),
+            rows_};
+  }
+
+  /// The units of the column of units U, if there is only one column of U.
+  template <typename U>
+  [[nodiscard]]
+  auto column() const noexcept -> std::span<const U> {
+    constexpr std::array<bool, sizeof...(Us)> matches{
+        std::is_same_v<U, Us>...};
+    static_assert(std::ranges::count(matches, true) == 1,
+                  "There must be exactly one column of U");
+    return column<static_cast<std::size_t>(
+        std::ranges::find(matches, true) - matches.begin())>();
+  }
+};
+
+} // namespace units
+} // namespace via
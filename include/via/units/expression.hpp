@@ -0,0 +1,442 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Lazy, fused element-wise arithmetic over spans and columns of
+/// units.
+///
+/// `lazy` wraps a span, `UnitColumn` or other contiguous range of units or
+/// floating point values in an expression. The arithmetic operators on
+/// expressions build a tree of the operations, e.g.
+/// `lazy(a) + lazy(b) - lazy(c)`, without evaluating it.
+/// `evaluate` then evaluates the tree in a single pass over the elements, in
+/// SIMD lanes, without allocating any intermediate arrays.
+///
+/// The element types of the tree are checked with the operators of the
+/// elements: `Metres + Metres` is `Metres`, `Metres / Seconds` is
+/// `MetresPerSecond`, but `Metres + Feet` does not compile, just as for
+/// scalar units. Each element is evaluated with the same IEEE 754 operations
+/// as the scalar expression.
+//////////////////////////////////////////////////////////////////////////////
+#include "column.hpp"
+#include "parallel.hpp"
+#include "quantity.hpp"
+#include "simd.hpp"
+#include "trace.hpp"
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace via {
+namespace units {
+namespace expression {
+
+/// The element types of expressions: units with floating point values and
+/// floating point values.
+template <typename E>
+concept Element = (Unit<E> && std::floating_point<unit_value_t<E>>) ||
+                  std::floating_point<E>;
+
+namespace detail {
+template <typename E> struct element_value {
+  using type = E;
+};
+
+template <Unit E> struct element_value<E> {
+  using type = unit_value_t<E>;
+};
+} // namespace detail
+
+/// The value type of an Element, e.g. double for Metres<double>.
+template <Element E>
+using element_value_t = typename detail::element_value<E>::type;
+
+/// The size of an expression of constants, which have no size.
+constexpr std::size_t UNSIZED{std::dynamic_extent};
+
+/// A leaf of an expression: a span of elements.
+template <Element E> class Span final {
+public:
+  using element_type = E;
+  using value_type = element_value_t<E>;
+
+  /// Constructor
+  /// @param elements the elements.
+  constexpr explicit Span(const std::span<const E> elements) noexcept
+      : data_{reinterpret_cast<const value_type *>(elements.data())},
+        size_{elements.size()} {}
+
+  /// The number of elements.
+  [[nodiscard("Pure Function")]]
+  constexpr auto size() const noexcept -> std::size_t {
+    return size_;
+  }
+
+  /// The values of the elements at index i in the lanes of V.
+  template <typename V>
+  [[nodiscard("Pure Function")]]
+  auto eval(const std::size_t i) const noexcept -> typename V::type {
+    return V::load(data_ + i);
+  }
+
+private:
+  const value_type *data_;
+  std::size_t size_;
+};
+
+/// A leaf of an expression: an element broadcast to every index, e.g. the
+/// 2.0 in `lazy(a) * 2.0`.
+template <Element E> class Constant final {
+public:
+  using element_type = E;
+  using value_type = element_value_t<E>;
+
+  /// Constructor
+  /// @param element the element.
+  constexpr explicit Constant(const E element) noexcept
+      : value_{value_of(element)} {}
+
+  /// A constant has no size: `UNSIZED`.
+  [[nodiscard("Pure Function")]]
+  constexpr auto size() const noexcept -> std::size_t {
+    return UNSIZED;
+  }
+
+  /// The value of the element in every lane of V.
+  template <typename V>
+  [[nodiscard("Pure Function")]]
+  auto eval(const std::size_t) const noexcept -> typename V::type {
+    return V::broadcast(value_);
+  }
+
+private:
+  value_type value_;
+
+  static constexpr auto value_of(const E element) noexcept -> value_type {
+    if constexpr (Unit<E>)
+      return element.v();
+    else
+      return element;
+  }
+};
+
+/// The binary operations of expressions.
+/// `result` is the element type of the operation on elements of types A and
+/// B: it is only valid if the elements have the operator.
+struct Add {
+  template <typename A, typename B>
+  using result = decltype(std::declval<A>() + std::declval<B>());
+
+  template <typename V>
+  static auto apply(const typename V::type a,
+                    const typename V::type b) noexcept -> typename V::type {
+    return V::add(a, b);
+  }
+};
+
+struct Subtract {
+  template <typename A, typename B>
+  using result = decltype(std::declval<A>() - std::declval<B>());
+
+  template <typename V>
+  static auto apply(const typename V::type a,
+                    const typename V::type b) noexcept -> typename V::type {
+    return V::sub(a, b);
+  }
+};
+
+struct Multiply {
+  template <typename A, typename B>
+  using result = decltype(std::declval<A>() * std::declval<B>());
+
+  template <typename V>
+  static auto apply(const typename V::type a,
+                    const typename V::type b) noexcept -> typename V::type {
+    return V::mul(a, b);
+  }
+};
+
+struct Divide {
+  template <typename A, typename B>
+  using result = decltype(std::declval<A>() / std::declval<B>());
+
+  template <typename V>
+  static auto apply(const typename V::type a,
+                    const typename V::type b) noexcept -> typename V::type {
+    return V::div(a, b);
+  }
+};
+
+/// A node of an expression: a binary operation on two expressions.
+template <typename Op, typename L, typename R> class Binary final {
+public:
+  using element_type =
+      typename Op::template result<typename L::element_type,
+                                   typename R::element_type>;
+  using value_type = element_value_t<element_type>;
+
+  /// Constructor
+  /// @pre the sizes of lhs and rhs are equal, unless one is `UNSIZED`.
+  /// @param lhs, rhs the operands.
+  constexpr Binary(const L lhs, const R rhs) noexcept : lhs_{lhs}, rhs_{rhs} {
+    assert(lhs.size() == UNSIZED || rhs.size() == UNSIZED ||
+           lhs.size() == rhs.size());
+  }
+
+  /// The number of elements: the size of the sized operand.
+  [[nodiscard("Pure Function")]]
+  constexpr auto size() const noexcept -> std::size_t {
+    return lhs_.size() == UNSIZED ? rhs_.size() : lhs_.size();
+  }
+
+  /// The values of the operation at index i in the lanes of V.
+  template <typename V>
+  [[nodiscard("Pure Function")]]
+  auto eval(const std::size_t i) const noexcept -> typename V::type {
+    return Op::template apply<V>(lhs_.template eval<V>(i),
+                                 rhs_.template eval<V>(i));
+  }
+
+private:
+  L lhs_;
+  R rhs_;
+};
+
+/// A node of an expression: the negation of an expression.
+template <typename X> class Negate final {
+public:
+  using element_type = decltype(-std::declval<typename X::element_type>());
+  using value_type = element_value_t<element_type>;
+
+  /// Constructor
+  /// @param x the expression to negate.
+  constexpr explicit Negate(const X x) noexcept : x_{x} {}
+
+  /// The number of elements.
+  [[nodiscard("Pure Function")]]
+  constexpr auto size() const noexcept -> std::size_t {
+    return x_.size();
+  }
+
+  /// The negated values at index i in the lanes of V: subtracted from zero
+  /// like the unary minus of a Quantity, or from -0 for values, which is
+  /// identical to their unary minus.
+  template <typename V>
+  [[nodiscard("Pure Function")]]
+  auto eval(const std::size_t i) const noexcept -> typename V::type {
+    constexpr value_type zero{Unit<element_type> ? value_type()
+                                                 : -value_type()};
+    return V::sub(V::broadcast(zero), x_.template eval<V>(i));
+  }
+
+private:
+  X x_;
+};
+
+namespace detail {
+template <typename X> struct is_expression : std::false_type {};
+
+template <Element E> struct is_expression<Span<E>> : std::true_type {};
+
+template <typename Op, typename L, typename R>
+struct is_expression<Binary<Op, L, R>> : std::true_type {};
+
+template <typename X> struct is_expression<Negate<X>> : std::true_type {};
+} // namespace detail
+
+/// An expression with a size: a Span, or an operation on one.
+template <typename X>
+concept Expression = detail::is_expression<X>::value;
+
+/// An operand of the expression operators: an expression or an Element,
+/// which is a Constant in the expression.
+template <typename A>
+concept Operand = Expression<A> || Element<A>;
+
+/// An Operand as an expression.
+template <Operand A>
+[[nodiscard("Pure Function")]]
+constexpr auto as_expression(const A a) noexcept {
+  if constexpr (Expression<A>)
+    return a;
+  else
+    return Constant<A>(a);
+}
+
+/// The expression of the binary operation Op on operands A and B, if at
+/// least one is an expression and their elements have the operator.
+template <typename Op, typename A, typename B>
+concept BinaryOperands =
+    Operand<A> && Operand<B> && (Expression<A> || Expression<B>) &&
+    requires {
+      typename Op::template result<
+          typename decltype(as_expression(std::declval<A>()))::element_type,
+          typename decltype(as_expression(std::declval<B>()))::element_type>;
+    };
+
+/// The binary expression of Op on operands a and b.
+template <typename Op, typename A, typename B>
+[[nodiscard("Pure Function")]]
+constexpr auto make_binary(const A a, const B b) noexcept {
+  using L = decltype(as_expression(a));
+  using R = decltype(as_expression(b));
+  return Binary<Op, L, R>(as_expression(a), as_expression(b));
+}
+
+/// The element-wise sum of the operands.
+template <typename A, typename B>
+  requires BinaryOperands<Add, A, B>
+[[nodiscard("Pure Function")]]
+constexpr auto operator+(const A a, const B b) noexcept {
+  return make_binary<Add>(a, b);
+}
+
+/// The element-wise difference of the operands.
+template <typename A, typename B>
+  requires BinaryOperands<Subtract, A, B>
+[[nodiscard("Pure Function")]]
+constexpr auto operator-(const A a, const B b) noexcept {
+  return make_binary<Subtract>(a, b);
+}
+
+/// The element-wise product of the operands.
+template <typename A, typename B>
+  requires BinaryOperands<Multiply, A, B>
+[[nodiscard("Pure Function")]]
+constexpr auto operator*(const A a, const B b) noexcept {
+  return make_binary<Multiply>(a, b);
+}
+
+/// The element-wise quotient of the operands.
+template <typename A, typename B>
+  requires BinaryOperands<Divide, A, B>
+[[nodiscard("Pure Function")]]
+constexpr auto operator/(const A a, const B b) noexcept {
+  return make_binary<Divide>(a, b);
+}
+
+/// The element-wise negation of an expression.
+template <Expression X>
+[[nodiscard("Pure Function")]]
+constexpr auto operator-(const X x) noexcept -> Negate<X> {
+  return Negate<X>(x);
+}
+
+namespace detail {
+
+/// Evaluate the elements [first, last) of an expression into out: in SIMD
+/// lanes, then the remaining elements one at a time.
+template <Expression X, typename T = typename X::value_type>
+void evaluate(const X &x, T *out, const std::size_t first,
+              const std::size_t last) noexcept {
+  using V = simd::Lanes<T>;
+  using S = simd::Scalar<T>;
+  VIA_UNITS_TRACE_CALL("evaluate", last - first, typename X::element_type);
+  std::size_t i{first};
+  for (; i + V::size <= last; i += V::size)
+    V::store(out + i, x.template eval<V>(i));
+  for (; i < last; ++i)
+    S::store(out + i, x.template eval<S>(i));
+}
+
+} // namespace detail
+} // namespace expression
+
+/// An expression of a contiguous range of units or floating point values,
+/// e.g. a span, a `std::vector` or a `UnitColumn`.
+/// The expression refers to the elements of the range, so the range must
+/// outlive the expression.
+/// @param range the units or values.
+/// @return the expression of the elements of the range.
+template <typename R>
+  requires std::ranges::contiguous_range<R> &&
+           std::ranges::sized_range<R> && std::ranges::borrowed_range<R> &&
+           expression::Element<std::ranges::range_value_t<R>>
+[[nodiscard("Pure Function")]]
+constexpr auto lazy(R &&range) noexcept {
+  using E = std::ranges::range_value_t<R>;
+  return expression::Span<E>(
+      std::span<const E>(std::ranges::data(range), std::ranges::size(range)));
+}
+
+/// Evaluate an expression in a single pass over its elements, in SIMD lanes.
+/// `out` may be one of the spans of the expression.
+/// @pre the expression has a size and out.size() >= x.size()
+/// @param x the expression.
+/// @param out the elements of the expression.
+template <expression::Expression X>
+void evaluate(const X &x, std::span<typename X::element_type> out) noexcept {
+  assert(x.size() <= out.size());
+  expression::detail::evaluate(
+      x, reinterpret_cast<typename X::value_type *>(out.data()), 0, x.size());
+}
+
+/// Evaluate an expression into a column, which is resized to the size of
+/// the expression.
+/// @param x the expression.
+/// @param out the column of the elements of the expression.
+template <expression::Expression X>
+  requires ColumnUnit<typename X::element_type>
+void evaluate(const X &x, UnitColumn<typename X::element_type> &out) {
+  out.resize_for_overwrite(x.size());
+  evaluate(x, out.units());
+}
+
+/// Evaluate an expression with an execution policy.
+/// `out` may be one of the spans of the expression.
+/// @pre the expression has a size and out.size() >= x.size()
+/// @param policy the execution policy.
+/// @param x the expression.
+/// @param out the elements of the expression.
+template <ExecutionPolicy P, expression::Expression X>
+void evaluate(const P &policy, const X &x,
+              std::span<typename X::element_type> out) {
+  using T = typename X::value_type;
+  assert(x.size() <= out.size());
+  auto *dst{reinterpret_cast<T *>(out.data())};
+  detail::for_each_chunk<T>(
+      policy, x.size(), [&x, dst](const std::size_t first,
+                                  const std::size_t count) {
+        expression::detail::evaluate(x, dst, first, first + count);
+      });
+}
+
+/// Evaluate an expression into a column with an execution policy.
+/// The column is resized to the size of the expression.
+/// @param policy the execution policy.
+/// @param x the expression.
+/// @param out the column of the elements of the expression.
+template <ExecutionPolicy P, expression::Expression X>
+  requires ColumnUnit<typename X::element_type>
+void evaluate(const P &policy, const X &x,
+              UnitColumn<typename X::element_type> &out) {
+  out.resize_for_overwrite(x.size());
+  evaluate(policy, x, out.units());
+}
+
+} // namespace units
+} // namespace via
@@ -0,0 +1,1078 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Distances and initial bearings between positions on the Earth.
+///
+/// Two models of the Earth trade accuracy for speed:
+///
+/// - a sphere of the mean radius of the Earth: the great circle distance is
+/// calculated by the haversine formula, within 0.6% of the ellipsoidal
+/// distance,
+/// - the WGS 84 ellipsoid: the geodesic distance is calculated by Karney's
+/// solution of the inverse problem, within 15 nm of the exact geodesic,
+/// including for nearly antipodal positions.
+///
+/// The haversine formula is evaluated by kernels that only add, multiply,
+/// divide, take square roots and select: sin is a polynomial after the
+/// reduction of its argument and atan2 halves its angle three times before a
+/// polynomial, so the batch functions evaluate them in SIMD lanes.
+/// The same kernels evaluate the scalar `great_circle_distance`, so its
+/// results are bit-for-bit identical to the batch functions.
+//////////////////////////////////////////////////////////////////////////////
+#include "non_si.hpp"
+#include "si.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+
+namespace via {
+namespace units {
+namespace geodesy {
+
+/// The mean radius of the Earth, (2a + b) / 3 of the WGS 84 ellipsoid,
+/// the radius of the great circle distances.
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Metres<T> EARTH_MEAN_RADIUS{T(6'371'008.8)};
+
+/// The semi-major axis of the WGS 84 ellipsoid.
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Metres<T> WGS84_SEMI_MAJOR_AXIS{T(6'378'137)};
+
+/// The flattening of the WGS 84 ellipsoid.
+template <typename T>
+  requires std::floating_point<T>
+constexpr T WGS84_FLATTENING{T(1) / T(298.257'223'563)};
+
+/// A position on the Earth: its geodetic latitude and longitude in degrees.
+template <typename T>
+  requires std::floating_point<T>
+struct LatLong {
+  /// The latitude in degrees, -90 to 90, positive North.
+  T latitude;
+  /// The longitude in degrees, positive East.
+  T longitude;
+
+  constexpr auto operator==(const LatLong &) const noexcept -> bool = default;
+};
+
+namespace detail {
+
+/// The number of positions converted to radians at a time by the batch
+/// functions.
+constexpr std::size_t BLOCK_SIZE{256};
+
+template <typename T>
+constexpr T RADIANS_PER_DEGREE{std::numbers::pi_v<T> / T(180)};
+
+template <typename T>
+constexpr T DEGREES_PER_RADIAN{T(180) / std::numbers::pi_v<T>};
+
+/// Pi split into a value and a correction, for the reduction of arguments.
+template <typename T>
+constexpr T PI_HIGH{static_cast<T>(std::numbers::pi_v<long double>)};
+
+template <typename T>
+constexpr T PI_LOW{static_cast<T>(std::numbers::pi_v<long double> -
+                                  static_cast<long double>(PI_HIGH<T>))};
+
+/// Adding and subtracting 1.5 * 2^(digits - 1) rounds a value of less than
+/// 2^(digits - 2) to the nearest integer.
+template <typename T>
+constexpr T ROUNDING_CONSTANT{
+    T(3) *
+    static_cast<T>(std::uint64_t(1) << (std::numeric_limits<T>::digits - 2))};
+
+/// The Taylor series coefficients of sin(x) / x in powers of x^2, enough for
+/// the precision of T on [-pi/2, pi/2].
+template <typename T>
+constexpr auto SIN_COEFFICIENTS{[] {
+  std::array<T, std::same_as<T, float> ? 7 : 11> coefficients;
+  long double term{1};
+  for (std::size_t i{0}; i < coefficients.size(); ++i) {
+    coefficients[i] = static_cast<T>(term);
+    term /= -static_cast<long double>((2 * i + 2) * (2 * i + 3));
+  }
+  return coefficients;
+}()};
+
+/// The Taylor series coefficients of atan(x) / x in powers of x^2, enough for
+/// the precision of T on [-tan(pi/32), tan(pi/32)].
+template <typename T>
+constexpr auto ATAN_COEFFICIENTS{[] {
+  std::array<T, std::same_as<T, float> ? 5 : 9> coefficients;
+  for (std::size_t i{0}; i < coefficients.size(); ++i)
+    coefficients[i] = (i % 2 ? T(-1) : T(1)) / static_cast<T>(2 * i + 1);
+  return coefficients;
+}()};
+
+/// Evaluate x times a polynomial in x^2.
+template <typename V, typename T, std::size_t N>
+auto odd_polynomial(const typename V::type x,
+                    const std::array<T, N> &coefficients) noexcept ->
+    typename V::type {
+  const auto x2{V::mul(x, x)};
+  auto p{V::broadcast(coefficients[N - 1])};
+  for (std::size_t i{N - 1}; i-- > 0;)
+    p = V::add(V::mul(p, x2), V::broadcast(coefficients[i]));
+  return V::mul(x, p);
+}
+
+/// sin(x) for x in [-pi/2, pi/2].
+template <typename T, typename V>
+auto sin(const typename V::type x) noexcept -> typename V::type {
+  return odd_polynomial<V>(x, SIN_COEFFICIENTS<T>);
+}
+
+/// sin(x)^2 for any x of less than 2^20 radians: x is reduced to
+/// [-pi/2, pi/2] by subtracting a multiple of pi.
+template <typename T, typename V>
+auto sin_squared(const typename V::type x) noexcept -> typename V::type {
+  const auto rounding{V::broadcast(ROUNDING_CONSTANT<T>)};
+  const auto k{V::sub(
+      V::add(V::mul(x, V::broadcast(std::numbers::inv_pi_v<T>)), rounding),
+      rounding)};
+  const auto reduced{V::sub(V::sub(x, V::mul(k, V::broadcast(PI_HIGH<T>))),
+                            V::mul(k, V::broadcast(PI_LOW<T>)))};
+  const auto s{sin<T, V>(reduced)};
+  return V::mul(s, s);
+}
+
+/// cos(x) for x in [-pi/2, pi/2]: sin(pi/2 - |x|).
+template <typename T, typename V>
+auto cos_latitude(const typename V::type x) noexcept -> typename V::type {
+  const auto zero{V::broadcast(T(0))};
+  const auto abs_x{V::select_less(x, zero, V::sub(zero, x), x)};
+  return sin<T, V>(
+      V::sub(V::broadcast(std::numbers::pi_v<T> / T(2)), abs_x));
+}
+
+/// atan2(y, x) in [-pi, pi].
+/// The vector (x, y) is reflected into the right half plane, where its angle
+/// is 2 atan(y / (r + x)), the angle is halved three times with
+/// tan(a / 2) = tan(a) / (1 + sqrt(1 + tan(a)^2)) and atan is evaluated by
+/// its Taylor series.
+template <typename T, typename V>
+auto atan2(const typename V::type y, const typename V::type x) noexcept ->
+    typename V::type {
+  const auto zero{V::broadcast(T(0))};
+  const auto one{V::broadcast(T(1))};
+  const auto x_right{V::select_less(x, zero, V::sub(zero, x), x)};
+  const auto y_right{V::select_less(x, zero, V::sub(zero, y), y)};
+  const auto r{
+      V::sqrt(V::add(V::mul(x_right, x_right), V::mul(y_right, y_right)))};
+  // r + x is only zero at the origin, where the angle is zero.
+  const auto denominator{V::add(r, x_right)};
+  auto t{V::div(y_right, V::select_less(zero, denominator, denominator, one))};
+  for (int i{0}; i < 3; ++i)
+    t = V::div(t, V::add(one, V::sqrt(V::add(one, V::mul(t, t)))));
+  const auto angle{
+      V::mul(V::broadcast(T(16)), odd_polynomial<V>(t, ATAN_COEFFICIENTS<T>))};
+
+  // Reflect the angle back into the left half plane.
+  const auto pi{V::broadcast(std::numbers::pi_v<T>)};
+  const auto offset{V::select_less(
+      x, zero, V::select_less(y, zero, V::sub(zero, pi), pi), zero)};
+  return V::add(angle, offset);
+}
+
+/// The central angle between two positions in radians, by the haversine
+/// formula.
+/// The differences of the latitudes and longitudes are taken in degrees,
+/// which is exact for nearby positions, before converting them to radians.
+/// @param lat1, lon1, cos_phi1 the latitude and longitude in degrees and the
+/// cosine of the latitude of the first position.
+/// @param lat2, lon2, cos_phi2 the same for the second position.
+template <typename T, typename V>
+auto central_angle(const typename V::type lat1, const typename V::type lon1,
+                   const typename V::type cos_phi1,
+                   const typename V::type lat2, const typename V::type lon2,
+                   const typename V::type cos_phi2) noexcept ->
+    typename V::type {
+  const auto half_radians{V::broadcast(RADIANS_PER_DEGREE<T> / T(2))};
+  const auto one{V::broadcast(T(1))};
+  const auto h{V::add(
+      sin_squared<T, V>(V::mul(V::sub(lat2, lat1), half_radians)),
+      V::mul(V::mul(cos_phi1, cos_phi2),
+             sin_squared<T, V>(V::mul(V::sub(lon2, lon1), half_radians))))};
+  // h may exceed 1 by rounding for nearly antipodal positions.
+  const auto h_clamped{V::select_less(h, one, h, one)};
+  return V::mul(
+      V::broadcast(T(2)),
+      atan2<T, V>(V::sqrt(h_clamped), V::sqrt(V::sub(one, h_clamped))));
+}
+
+/// cos(latitude) for a latitude in degrees.
+template <typename T, typename V>
+auto cos_degrees(const typename V::type latitude) noexcept -> typename V::type {
+  return cos_latitude<T, V>(
+      V::mul(latitude, V::broadcast(RADIANS_PER_DEGREE<T>)));
+}
+
+/// The factor from a central angle to a distance in units To on the sphere.
+template <typename To>
+constexpr auto RADIUS{static_cast<typename To::value_type>(
+    static_cast<long double>(EARTH_MEAN_RADIUS<typename To::value_type>.v()) /
+    static_cast<long double>(To::si_factor))};
+
+/// The geodesic between two positions on the WGS 84 ellipsoid.
+struct Geodesic {
+  /// The length of the geodesic in metres.
+  double length;
+  /// The initial azimuth of the geodesic in radians.
+  double azimuth;
+};
+
+/// Karney's solution of the inverse geodesic problem on the WGS 84 ellipsoid,
+/// in double precision, after GeographicLib.
+/// C. F. F. Karney, Algorithms for geodesics, J. Geodesy 87, 43-55 (2013).
+namespace karney {
+
+/// The order of the series in the third flattening.
+constexpr int ORDER{6};
+
+constexpr double A{WGS84_SEMI_MAJOR_AXIS<double>.v()};
+constexpr double F{WGS84_FLATTENING<double>};
+constexpr double F1{1 - F};
+constexpr double B{A * F1};
+/// The second eccentricity squared.
+constexpr double EP2{F * (2 - F) / (F1 * F1)};
+/// The third flattening.
+constexpr double N{F / (2 - F)};
+
+/// sqrt of the smallest normal double.
+constexpr double TINY{0x1p-511};
+constexpr double TOL0{std::numeric_limits<double>::epsilon()};
+constexpr double TOL1{200 * TOL0};
+/// sqrt(TOL0)
+constexpr double TOL2{0x1p-26};
+constexpr double XTHRESH{1000 * TOL2};
+/// The Newton iterations, before bisection takes over.
+constexpr int MAXIT1{20};
+constexpr int MAXIT2{MAXIT1 + std::numeric_limits<double>::digits + 10};
+/// The central angle below which a geodesic is "really short".
+inline const double ETOL2{0.1 * TOL2 / std::sqrt(F * (1 - F / 2) / 2)};
+
+/// The coefficients of the series, index 0 is unused.
+using Coefficients = std::array<double, ORDER + 1>;
+
+/// A polynomial of degree n in x, coefficients p from the highest power.
+constexpr auto polyval(int n, const double *p, const double x) noexcept
+    -> double {
+  double y{n < 0 ? 0 : *p};
+  while (n-- > 0)
+    y = y * x + *++p;
+  return y;
+}
+
+/// The coefficients of A3 as polynomials in N.
+constexpr std::array<double, ORDER> A3X{[] {
+  constexpr std::array<double, 18> coeff{
+      -3, 128,
+      -2, -3, 64,
+      -1, -3, -1, 16,
+      3, -1, -2, 8,
+      1, -1, 2,
+      1, 1};
+  std::array<double, ORDER> a3x{};
+  std::size_t k{0};
+  int o{0};
+  for (int j{ORDER - 1}; j >= 0; --j) {
+    const int m{std::min(ORDER - j - 1, j)};
+    a3x[k++] = polyval(m, coeff.data() + o, N) / coeff[o + m + 1];
+    o += m + 2;
+  }
+  return a3x;
+}()};
+
+/// The coefficients of C3 as polynomials in N.
+constexpr std::array<double, ORDER * (ORDER - 1) / 2> C3X{[] {
+  constexpr std::array<double, 45> coeff{
+      3, 128,
+      2, 5, 128,
+      -1, 3, 3, 64,
+      -1, 0, 1, 8,
+      -1, 1, 4,
+      5, 256,
+      1, 3, 128,
+      -3, -2, 3, 64,
+      1, -3, 2, 32,
+      7, 512,
+      -10, 9, 384,
+      5, -9, 5, 192,
+      7, 512,
+      -14, 7, 512,
+      21, 2560};
+  std::array<double, ORDER * (ORDER - 1) / 2> c3x{};
+  std::size_t k{0};
+  int o{0};
+  for (int l{1}; l < ORDER; ++l)
+    for (int j{ORDER - 1}; j >= l; --j) {
+      const int m{std::min(ORDER - j - 1, j)};
+      c3x[k++] = polyval(m, coeff.data() + o, N) / coeff[o + m + 1];
+      o += m + 2;
+    }
+  return c3x;
+}()};
+
+/// The coefficients of a series in eps of order ORDER with polynomial
+/// coefficients in eps^2.
+inline void series(const double eps, const double *coeff,
+                   Coefficients &c) noexcept {
+  const double eps2{eps * eps};
+  double d{eps};
+  int o{0};
+  for (int l{1}; l <= ORDER; ++l) {
+    const int m{(ORDER - l) / 2};
+    c[l] = d * polyval(m, coeff + o, eps2) / coeff[o + m + 1];
+    o += m + 2;
+    d *= eps;
+  }
+}
+
+/// A1 - 1
+inline auto a1m1(const double eps) noexcept -> double {
+  constexpr std::array<double, 5> coeff{1, 4, 64, 0, 256};
+  const double t{polyval(ORDER / 2, coeff.data(), eps * eps) /
+                 coeff[ORDER / 2 + 1]};
+  return (t + eps) / (1 - eps);
+}
+
+inline void c1(const double eps, Coefficients &c) noexcept {
+  constexpr std::array<double, 18> coeff{
+      -1, 6, -16, 32,
+      -9, 64, -128, 2048,
+      9, -16, 768,
+      3, -5, 512,
+      -7, 1280,
+      -7, 2048};
+  series(eps, coeff.data(), c);
+}
+
+/// A2 - 1
+inline auto a2m1(const double eps) noexcept -> double {
+  constexpr std::array<double, 5> coeff{-11, -28, -192, 0, 256};
+  const double t{polyval(ORDER / 2, coeff.data(), eps * eps) /
+                 coeff[ORDER / 2 + 1]};
+  return (t - eps) / (1 + eps);
+}
+
+inline void c2(const double eps, Coefficients &c) noexcept {
+  constexpr std::array<double, 18> coeff{
+      1, 2, 16, 32,
+      35, 64, 384, 2048,
+      15, 80, 768,
+      7, 35, 512,
+      63, 1280,
+      77, 2048};
+  series(eps, coeff.data(), c);
+}
+
+inline auto a3(const double eps) noexcept -> double {
+  return polyval(ORDER - 1, A3X.data(), eps);
+}
+
+/// C3, c[1] to c[ORDER - 1].
+inline void c3(const double eps, Coefficients &c) noexcept {
+  double mult{1};
+  int o{0};
+  for (int l{1}; l < ORDER; ++l) {
+    const int m{ORDER - l - 1};
+    mult *= eps;
+    c[l] = mult * polyval(m, C3X.data() + o, eps);
+    o += m + 1;
+  }
+}
+
+/// sum(c[i] * sin(2 i x), i, 1, n) by Clenshaw summation.
+inline auto sin_series(const double sinx, const double cosx,
+                       const Coefficients &c, const int n) noexcept
+    -> double {
+  const double ar{2 * (cosx - sinx) * (cosx + sinx)};
+  int k{n + 1};
+  double y0{n & 1 ? c[--k] : 0};
+  double y1{0};
+  for (int i{n / 2}; i != 0; --i) {
+    y1 = ar * y0 - y1 + c[--k];
+    y0 = ar * y1 - y0 + c[--k];
+  }
+  return 2 * sinx * cosx * y0;
+}
+
+inline void normalize(double &x, double &y) noexcept {
+  const double r{std::hypot(x, y)};
+  x /= r;
+  y /= r;
+}
+
+/// u + v, with the rounding error in t.
+inline auto sum(const double u, const double v, double &t) noexcept
+    -> double {
+  const double s{u + v};
+  double up{s - v};
+  double vpp{s - up};
+  up -= u;
+  vpp -= v;
+  t = s != 0 ? 0.0 - (up + vpp) : s;
+  return s;
+}
+
+/// Rounds an angle in degrees so that small values underflow to zero.
+inline auto round_angle(const double x) noexcept -> double {
+  constexpr double z{1.0 / 16};
+  double y{std::abs(x)};
+  if (y < z)
+    y = z - (z - y);
+  return std::copysign(y, x);
+}
+
+/// y - x in degrees in [-180, 180], with the rounding error in e.
+inline auto angle_difference(const double x, const double y,
+                             double &e) noexcept -> double {
+  double d{sum(std::remainder(-x, 360.0), std::remainder(y, 360.0), e)};
+  d = sum(std::remainder(d, 360.0), e, e);
+  if (d == 0 || std::abs(d) == 180)
+    d = std::copysign(d, e == 0 ? y - x : -e);
+  return d;
+}
+
+/// The sine and cosine of the angle q * 90 + r degrees.
+inline void quadrant(const int q, const double r, double &sinx,
+                     double &cosx) noexcept {
+  const double s{std::sin(r * RADIANS_PER_DEGREE<double>)};
+  const double c{std::cos(r * RADIANS_PER_DEGREE<double>)};
+  switch (static_cast<unsigned>(q) & 3U) {
+  case 0U:
+    sinx = s;
+    cosx = c;
+    break;
+  case 1U:
+    sinx = c;
+    cosx = -s;
+    break;
+  case 2U:
+    sinx = -s;
+    cosx = -c;
+    break;
+  default:
+    sinx = -c;
+    cosx = s;
+    break;
+  }
+  cosx += 0.0;
+}
+
+/// The sine and cosine of x degrees, exact for multiples of 90.
+inline void sin_cos_degrees(const double x, double &sinx,
+                            double &cosx) noexcept {
+  int q{0};
+  const double r{std::remquo(x, 90.0, &q)};
+  quadrant(q, r, sinx, cosx);
+  if (sinx == 0)
+    sinx = std::copysign(sinx, x);
+}
+
+/// The sine and cosine of x + t degrees, x in [-180, 180].
+inline void sin_cos_degrees(const double x, const double t, double &sinx,
+                            double &cosx) noexcept {
+  const int q{static_cast<int>(std::round(x / 90))};
+  quadrant(q, round_angle(x - 90 * q + t), sinx, cosx);
+  if (sinx == 0)
+    sinx = std::copysign(sinx, x);
+}
+
+/// The distance and reduced length of a geodesic divided by B.
+struct Lengths {
+  double s12b;
+  double m12b;
+};
+
+inline auto lengths(const double eps, const double sig12, const double ssig1,
+                    const double csig1, const double dn1, const double ssig2,
+                    const double csig2, const double dn2) noexcept
+    -> Lengths {
+  Coefficients c1a{};
+  Coefficients c2a{};
+  c1(eps, c1a);
+  c2(eps, c2a);
+  const double a1{1 + a1m1(eps)};
+  const double a2{1 + a2m1(eps)};
+  const double b1{sin_series(ssig2, csig2, c1a, ORDER) -
+                  sin_series(ssig1, csig1, c1a, ORDER)};
+  const double b2{sin_series(ssig2, csig2, c2a, ORDER) -
+                  sin_series(ssig1, csig1, c2a, ORDER)};
+  const double j12{(a1 - a2) * sig12 + (a1 * b1 - a2 * b2)};
+  // The parentheses ensure cancellation for coincident positions.
+  return {a1 * (sig12 + b1), dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) -
+                                 csig1 * csig2 * j12};
+}
+
+/// The positive root k of k^4 + 2k^3 - (x^2 + y^2 - 1)k^2 - 2y^2 k - y^2.
+inline auto astroid(const double x, const double y) noexcept -> double {
+  const double p{x * x};
+  const double q{y * y};
+  const double r{(p + q - 1) / 6};
+  if (q == 0 && r <= 0)
+    return 0;
+
+  const double s{p * q / 4};
+  const double r2{r * r};
+  const double r3{r * r2};
+  const double disc{s * (s + 2 * r3)};
+  double u{r};
+  if (disc >= 0) {
+    double t3{s + r3};
+    t3 += t3 < 0 ? -std::sqrt(disc) : std::sqrt(disc);
+    const double t{std::cbrt(t3)};
+    u += t + (t != 0 ? r2 / t : 0);
+  } else {
+    const double angle{std::atan2(std::sqrt(-disc), -(s + r3))};
+    u += 2 * r * std::cos(angle / 3);
+  }
+  const double v{std::sqrt(u * u + q)};
+  const double uv{u < 0 ? q / (v - u) : u + v};
+  const double w{(uv - q) / (2 * v)};
+  return uv / (std::sqrt(uv + w * w) + w);
+}
+
+/// The starting point of Newton's method; sig12 is negative unless the
+/// geodesic is short enough to not need it.
+struct Start {
+  double sig12;
+  double salp1;
+  double calp1;
+  double salp2;
+  double calp2;
+  double dnm;
+};
+
+inline auto inverse_start(const double sbet1, const double cbet1,
+                          const double sbet2, const double cbet2,
+                          const double lam12, const double slam12,
+                          const double clam12) noexcept -> Start {
+  Start start{-1, 0, 0, 0, 0, 0};
+  const double sbet12{sbet2 * cbet1 - cbet2 * sbet1};
+  const double cbet12{cbet2 * cbet1 + sbet2 * sbet1};
+  const double sbet12a{sbet2 * cbet1 + cbet2 * sbet1};
+
+  const bool shortline{cbet12 >= 0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5};
+  double somg12{slam12};
+  double comg12{clam12};
+  if (shortline) {
+    double sbetm2{(sbet1 + sbet2) * (sbet1 + sbet2)};
+    sbetm2 /= sbetm2 + (cbet1 + cbet2) * (cbet1 + cbet2);
+    start.dnm = std::sqrt(1 + EP2 * sbetm2);
+    const double omg12{lam12 / (F1 * start.dnm)};
+    somg12 = std::sin(omg12);
+    comg12 = std::cos(omg12);
+  }
+
+  start.salp1 = cbet2 * somg12;
+  start.calp1 =
+      comg12 >= 0
+          ? sbet12 + cbet2 * sbet1 * somg12 * somg12 / (1 + comg12)
+          : sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1 - comg12);
+
+  const double ssig12{std::hypot(start.salp1, start.calp1)};
+  const double csig12{sbet1 * sbet2 + cbet1 * cbet2 * comg12};
+
+  if (shortline && ssig12 < ETOL2) {
+    start.salp2 = cbet1 * somg12;
+    start.calp2 =
+        sbet12 - cbet1 * sbet2 *
+                     (comg12 >= 0 ? somg12 * somg12 / (1 + comg12)
+                                  : 1 - comg12);
+    normalize(start.salp2, start.calp2);
+    start.sig12 = std::atan2(ssig12, csig12);
+  } else if (csig12 < 0 &&
+             ssig12 < 6 * N * std::numbers::pi * cbet1 * cbet1) {
+    // Nearly antipodal: scale to coordinates where the antipode is at the
+    // origin and the singular point is at y = 0, x = -1.
+    const double lam12x{std::atan2(-slam12, -clam12)};
+    const double k2{sbet1 * sbet1 * EP2};
+    const double eps{k2 / (2 * (1 + std::sqrt(1 + k2)) + k2)};
+    const double lamscale{F * cbet1 * a3(eps) * std::numbers::pi};
+    const double betscale{lamscale * cbet1};
+    const double x{lam12x / lamscale};
+    const double y{sbet12a / betscale};
+
+    if (y > -TOL1 && x > -1 - XTHRESH) {
+      start.salp1 = std::min(1.0, -x);
+      start.calp1 = -std::sqrt(1 - start.salp1 * start.salp1);
+    } else {
+      const double k{astroid(x, y)};
+      const double omg12a{lamscale * (-x * k / (1 + k))};
+      somg12 = std::sin(omg12a);
+      comg12 = -std::cos(omg12a);
+      start.salp1 = cbet2 * somg12;
+      start.calp1 = sbet12a - cbet2 * sbet1 * somg12 * somg12 / (1 - comg12);
+    }
+  }
+  // The reversed test allows NaN through.
+  if (!(start.salp1 <= 0))
+    normalize(start.salp1, start.calp1);
+  else {
+    start.salp1 = 1;
+    start.calp1 = 0;
+  }
+  return start;
+}
+
+/// The longitude difference of the geodesic from the first position at
+/// azimuth alp1, and its derivative with respect to alp1.
+struct Lambda {
+  double lam12;
+  double salp2;
+  double calp2;
+  double sig12;
+  double ssig1;
+  double csig1;
+  double ssig2;
+  double csig2;
+  double eps;
+  double dlam12;
+};
+
+inline auto lambda12(const double sbet1, const double cbet1, const double dn1,
+                     const double sbet2, const double cbet2, const double dn2,
+                     const double salp1, double calp1, const double slam120,
+                     const double clam120, const bool diffp) noexcept
+    -> Lambda {
+  // Break the degeneracy of the equatorial line.
+  if (sbet1 == 0 && calp1 == 0)
+    calp1 = -TINY;
+
+  Lambda result{};
+  const double salp0{salp1 * cbet1};
+  const double calp0{std::hypot(calp1, salp1 * sbet1)};
+
+  result.ssig1 = sbet1;
+  const double somg1{salp0 * sbet1};
+  result.csig1 = calp1 * cbet1;
+  const double comg1{result.csig1};
+  normalize(result.ssig1, result.csig1);
+
+  // Enforce symmetries where abs(bet2) = -bet1.
+  result.salp2 = cbet2 != cbet1 ? salp0 / cbet2 : salp1;
+  result.calp2 = cbet2 != cbet1 || std::abs(sbet2) != -sbet1
+                     ? std::sqrt(calp1 * cbet1 * calp1 * cbet1 +
+                                 (cbet1 < -sbet1
+                                      ? (cbet2 - cbet1) * (cbet1 + cbet2)
+                                      : (sbet1 - sbet2) * (sbet1 + sbet2))) /
+                           cbet2
+                     : std::abs(calp1);
+  result.ssig2 = sbet2;
+  const double somg2{salp0 * sbet2};
+  result.csig2 = result.calp2 * cbet2;
+  const double comg2{result.csig2};
+  normalize(result.ssig2, result.csig2);
+
+  result.sig12 = std::atan2(
+      std::max(0.0, result.csig1 * result.ssig2 - result.ssig1 * result.csig2) +
+          0.0,
+      result.csig1 * result.csig2 + result.ssig1 * result.ssig2);
+
+  const double somg12{std::max(0.0, comg1 * somg2 - somg1 * comg2) + 0.0};
+  const double comg12{comg1 * comg2 + somg1 * somg2};
+  const double eta{std::atan2(somg12 * clam120 - comg12 * slam120,
+                              comg12 * clam120 + somg12 * slam120)};
+
+  const double k2{calp0 * calp0 * EP2};
+  result.eps = k2 / (2 * (1 + std::sqrt(1 + k2)) + k2);
+  Coefficients c3a{};
+  c3(result.eps, c3a);
+  const double b312{sin_series(result.ssig2, result.csig2, c3a, ORDER - 1) -
+                    sin_series(result.ssig1, result.csig1, c3a, ORDER - 1)};
+  result.lam12 = eta - F * a3(result.eps) * salp0 * (result.sig12 + b312);
+
+  if (!diffp)
+    result.dlam12 = std::numeric_limits<double>::quiet_NaN();
+  else if (result.calp2 == 0)
+    result.dlam12 = -2 * F1 * dn1 / sbet1;
+  else
+    result.dlam12 =
+        lengths(result.eps, result.sig12, result.ssig1, result.csig1, dn1,
+                result.ssig2, result.csig2, dn2)
+            .m12b *
+        F1 / (result.calp2 * cbet2);
+  return result;
+}
+
+/// The geodesic between two positions in degrees.
+/// @return the geodesic, or NaNs if a latitude is outside [-90, 90].
+inline auto inverse(double lat1, const double lon1, double lat2,
+                    const double lon2) noexcept -> Geodesic {
+  // Make the longitude difference positive.
+  double lon12s{};
+  double lon12{angle_difference(lon1, lon2, lon12s)};
+  double lonsign{std::copysign(1.0, lon12)};
+  lon12 *= lonsign;
+  lon12s *= lonsign;
+  const double lam12{lon12 * RADIANS_PER_DEGREE<double>};
+  double slam12{};
+  double clam12{};
+  sin_cos_degrees(lon12, lon12s, slam12, clam12);
+  // The supplementary longitude difference.
+  lon12s = (180 - lon12) - lon12s;
+
+  // Treat positions really close to the equator as on it.
+  lat1 = round_angle(std::abs(lat1) > 90
+                         ? std::numeric_limits<double>::quiet_NaN()
+                         : lat1);
+  lat2 = round_angle(std::abs(lat2) > 90
+                         ? std::numeric_limits<double>::quiet_NaN()
+                         : lat2);
+  // Swap the positions so that the first has the larger abs latitude and
+  // make it non-positive, so that
+  // 0 <= lon12 <= 180, -90 <= lat1 <= 0 and lat1 <= lat2 <= -lat1.
+  const double swapp{std::abs(lat1) < std::abs(lat2) || std::isnan(lat2)
+                         ? -1.0
+                         : 1.0};
+  if (swapp < 0) {
+    lonsign = -lonsign;
+    std::swap(lat1, lat2);
+  }
+  const double latsign{std::copysign(1.0, -lat1)};
+  lat1 *= latsign;
+  lat2 *= latsign;
+
+  // The reduced latitudes, with cbet = +epsilon at the poles.
+  double sbet1{};
+  double cbet1{};
+  sin_cos_degrees(lat1, sbet1, cbet1);
+  sbet1 *= F1;
+  normalize(sbet1, cbet1);
+  cbet1 = std::max(TINY, cbet1);
+  double sbet2{};
+  double cbet2{};
+  sin_cos_degrees(lat2, sbet2, cbet2);
+  sbet2 *= F1;
+  normalize(sbet2, cbet2);
+  cbet2 = std::max(TINY, cbet2);
+
+  // Force bet2 = +/- bet1 when their difference vanishes.
+  if (cbet1 < -sbet1) {
+    if (cbet2 == cbet1)
+      sbet2 = std::copysign(sbet1, sbet2);
+  } else if (std::abs(sbet2) == -sbet1)
+    cbet2 = cbet1;
+
+  const double dn1{std::sqrt(1 + EP2 * sbet1 * sbet1)};
+  const double dn2{std::sqrt(1 + EP2 * sbet2 * sbet2)};
+
+  double s12x{};
+  double salp1{};
+  double calp1{};
+  double salp2{};
+  double calp2{};
+  bool meridian{lat1 == -90 || slam12 == 0};
+  if (meridian) {
+    // The positions are on a meridian, which may be the geodesic.
+    calp1 = clam12;
+    salp1 = slam12;
+    calp2 = 1;
+    salp2 = 0;
+    const double ssig1{sbet1};
+    const double csig1{calp1 * cbet1};
+    const double ssig2{sbet2};
+    const double csig2{cbet2};
+    double sig12{std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0,
+                            csig1 * csig2 + ssig1 * ssig2)};
+    auto [s12b, m12b]{
+        lengths(N, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2)};
+    // A meridian longer than half way round is not the shortest path.
+    if (sig12 < TOL2 || m12b >= 0) {
+      // Fused multiply-adds may not cancel sig12 for coincident positions.
+      if (sig12 < 3 * TINY || (sig12 < TOL0 && (s12b < 0 || m12b < 0)) ||
+          (lat1 == lat2 && lon12 == 0))
+        s12b = 0;
+      s12x = s12b * B;
+    } else
+      meridian = false;
+  }
+
+  if (!meridian && sbet1 == 0 && lon12s >= F * 180) {
+    // The geodesic runs along the equator.
+    calp1 = calp2 = 0;
+    salp1 = salp2 = 1;
+    s12x = A * lam12;
+  } else if (!meridian) {
+    const Start start{
+        inverse_start(sbet1, cbet1, sbet2, cbet2, lam12, slam12, clam12)};
+    salp1 = start.salp1;
+    calp1 = start.calp1;
+    if (start.sig12 >= 0) {
+      salp2 = start.salp2;
+      calp2 = start.calp2;
+      s12x = start.sig12 * B * start.dnm;
+    } else {
+      // Newton's method on lambda12(alp1) - lam12, falling back to
+      // bisection of the bracketing range (alp1a, alp1b) when a step
+      // leaves it.
+      int numit{0};
+      bool tripn{false};
+      bool tripb{false};
+      double salp1a{TINY};
+      double calp1a{1};
+      double salp1b{TINY};
+      double calp1b{-1};
+      Lambda lambda{};
+      for (;;) {
+        lambda = lambda12(sbet1, cbet1, dn1, sbet2, cbet2, dn2, salp1, calp1,
+                          slam12, clam12, numit < MAXIT1);
+        const double v{lambda.lam12};
+        // The reversed test allows escape with NaNs.
+        if (tripb || !(std::abs(v) >= (tripn ? 8 : 1) * TOL0) ||
+            numit == MAXIT2)
+          break;
+        if (v > 0 && (numit > MAXIT1 || calp1 / salp1 > calp1b / salp1b)) {
+          salp1b = salp1;
+          calp1b = calp1;
+        } else if (v < 0 &&
+                   (numit > MAXIT1 || calp1 / salp1 < calp1a / salp1a)) {
+          salp1a = salp1;
+          calp1a = calp1;
+        }
+
+        ++numit;
+        if (numit < MAXIT1 && lambda.dlam12 > 0) {
+          const double dalp1{-v / lambda.dlam12};
+          if (std::abs(dalp1) < std::numbers::pi) {
+            const double sdalp1{std::sin(dalp1)};
+            const double cdalp1{std::cos(dalp1)};
+            const double nsalp1{salp1 * cdalp1 + calp1 * sdalp1};
+            if (nsalp1 > 0) {
+              calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+              salp1 = nsalp1;
+              normalize(salp1, calp1);
+              // Convergence may not be quadratic where the slope vanishes.
+              tripn = std::abs(v) <= 16 * TOL0;
+              continue;
+            }
+          }
+        }
+        salp1 = (salp1a + salp1b) / 2;
+        calp1 = (calp1a + calp1b) / 2;
+        normalize(salp1, calp1);
+        tripn = false;
+        tripb = std::abs(salp1a - salp1) + (calp1a - calp1) < TOL0 ||
+                std::abs(salp1 - salp1b) + (calp1 - calp1b) < TOL0;
+      }
+      salp2 = lambda.salp2;
+      calp2 = lambda.calp2;
+      s12x = lengths(lambda.eps, lambda.sig12, lambda.ssig1, lambda.csig1, dn1,
+                     lambda.ssig2, lambda.csig2, dn2)
+                 .s12b *
+             B;
+    }
+  }
+
+  // Undo the transformation to the canonical form.
+  if (swapp < 0) {
+    salp1 = salp2;
+    calp1 = calp2;
+  }
+  return {0.0 + s12x,
+          std::atan2(salp1 * swapp * lonsign, calp1 * swapp * latsign)};
+}
+
+} // namespace karney
+
+/// An angle in radians as a bearing in degrees, in [0, 360).
+template <typename T>
+auto to_bearing(const double radians) noexcept -> T {
+  const auto degrees{radians * DEGREES_PER_RADIAN<double>};
+  return static_cast<T>(degrees < 0 ? degrees + 360 : degrees);
+}
+
+/// The distances in units To from a position to a block of positions.
+/// @param count the number of positions in the block.
+template <typename To, typename T, typename V>
+void distances(const T lat1, const T lon1, const T cos_phi1, const T *lat2,
+               const T *lon2, const T *cos_phi2, const std::size_t count,
+               T *out) noexcept {
+  const auto radius{V::broadcast(RADIUS<To>)};
+  const auto a{V::broadcast(lat1)};
+  const auto b{V::broadcast(lon1)};
+  const auto c{V::broadcast(cos_phi1)};
+  for (std::size_t i{0}; i < count; i += V::size)
+    V::store(out + i, V::mul(radius, central_angle<T, V>(
+                                         a, b, c, V::load(lat2 + i),
+                                         V::load(lon2 + i),
+                                         V::load(cos_phi2 + i))));
+}
+
+} // namespace detail
+
+/// The great circle distance between two positions on a sphere of the mean
+/// radius of the Earth, by the haversine formula.
+/// The result is within 0.6% of the `ellipsoidal_distance`.
+/// Use `convert` for other units, e.g.
+/// `convert<NauticalMiles<double>>(great_circle_distance(a, b))`.
+/// @param a, b the positions.
+/// @return the distance.
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+auto great_circle_distance(const LatLong<T> a, const LatLong<T> b) noexcept
+    -> si::Metres<T> {
+  using S = simd::Scalar<T>;
+  return si::Metres<T>(
+      detail::RADIUS<si::Metres<T>> *
+      detail::central_angle<T, S>(a.latitude, a.longitude,
+                                  detail::cos_degrees<T, S>(a.latitude),
+                                  b.latitude, b.longitude,
+                                  detail::cos_degrees<T, S>(b.latitude)));
+}
+
+/// The initial bearing of the great circle from position a to position b.
+/// @param a, b the positions.
+/// @return the bearing in degrees clockwise from North, in [0, 360).
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+auto great_circle_bearing(const LatLong<T> a, const LatLong<T> b) noexcept
+    -> T {
+  constexpr double k{detail::RADIANS_PER_DEGREE<double>};
+  const double phi1{a.latitude * k};
+  const double phi2{b.latitude * k};
+  const double delta_lambda{(b.longitude - a.longitude) * k};
+  return detail::to_bearing<T>(std::atan2(
+      std::sin(delta_lambda) * std::cos(phi2),
+      std::cos(phi1) * std::sin(phi2) -
+          std::sin(phi1) * std::cos(phi2) * std::cos(delta_lambda)));
+}
+
+/// The distance between two positions along the geodesic on the WGS 84
+/// ellipsoid, by Karney's method.
+/// @param a, b the positions.
+/// @return the distance, or NaN if a latitude is outside [-90, 90].
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+auto ellipsoidal_distance(const LatLong<T> a, const LatLong<T> b) noexcept
+    -> si::Metres<T> {
+  return si::Metres<T>(static_cast<T>(
+      detail::karney::inverse(a.latitude, a.longitude, b.latitude,
+                              b.longitude)
+          .length));
+}
+
+/// The initial bearing of the geodesic on the WGS 84 ellipsoid from
+/// position a to position b, by Karney's method.
+/// Where several geodesics are shortest, e.g. between antipodal positions,
+/// it is the bearing of one of them.
+/// @param a, b the positions.
+/// @return the bearing in degrees clockwise from North, in [0, 360),
+/// or NaN if a latitude is outside [-90, 90].
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+auto ellipsoidal_bearing(const LatLong<T> a, const LatLong<T> b) noexcept
+    -> T {
+  return detail::to_bearing<T>(
+      detail::karney::inverse(a.latitude, a.longitude, b.latitude,
+                              b.longitude)
+          .azimuth);
+}
+
+/// The great circle distances between each of the positions from and each
+/// of the positions to, in units To, e.g. NauticalMiles.
+/// The cosines of the latitudes of the positions to are calculated a block
+/// at a time, then the distances from every position from to the block are
+/// calculated in SIMD lanes. The results are bit-for-bit identical to
+/// `great_circle_distance` for Metres, and within 1 ulp of converting it for
+/// other units.
+/// @pre out.size() >= from.size() * to.size()
+/// @param from, to the positions.
+/// @param out the distances: out[i * to.size() + j] is the distance from
+/// from[i] to to[j].
+template <typename To, typename T>
+  requires std::same_as<typename To::dimension, Length> &&
+           std::same_as<typename To::value_type, T> && std::floating_point<T>
+void great_circle_distance_matrix(std::span<const LatLong<T>> from,
+                                  std::span<const LatLong<T>> to,
+                                  std::span<To> out) noexcept {
+  using V = simd::Lanes<T>;
+  using S = simd::Scalar<T>;
+  assert(from.size() * to.size() <= out.size());
+  auto *const dst{reinterpret_cast<T *>(out.data())};
+
+  alignas(64) std::array<T, detail::BLOCK_SIZE> lat2;
+  alignas(64) std::array<T, detail::BLOCK_SIZE> lon2;
+  alignas(64) std::array<T, detail::BLOCK_SIZE> cos_phi2;
+  for (std::size_t first{0}; first < to.size(); first += detail::BLOCK_SIZE) {
+    const auto count{std::min(detail::BLOCK_SIZE, to.size() - first)};
+    for (std::size_t j{0}; j < count; ++j) {
+      lat2[j] = to[first + j].latitude;
+      lon2[j] = to[first + j].longitude;
+    }
+    const auto lanes{count - count % V::size};
+    for (std::size_t j{0}; j < lanes; j += V::size)
+      V::store(cos_phi2.data() + j,
+               detail::cos_degrees<T, V>(V::load(lat2.data() + j)));
+    for (std::size_t j{lanes}; j < count; ++j)
+      cos_phi2[j] = detail::cos_degrees<T, S>(lat2[j]);
+
+    for (std::size_t i{0}; i < from.size(); ++i) {
+      const T lat1{from[i].latitude};
+      const T lon1{from[i].longitude};
+      const T cos_phi1{detail::cos_degrees<T, S>(lat1)};
+      T *const row{dst + i * to.size() + first};
+      detail::distances<To, T, V>(lat1, lon1, cos_phi1, lat2.data(),
+                                  lon2.data(), cos_phi2.data(), lanes, row);
+      detail::distances<To, T, S>(lat1, lon1, cos_phi1, lat2.data() + lanes,
+                                  lon2.data() + lanes, cos_phi2.data() + lanes,
+                                  count - lanes, row + lanes);
+    }
+  }
+}
+
+/// The great circle distances from a position to each of the positions to,
+/// in units To, e.g. NauticalMiles. See `great_circle_distance_matrix`.
+/// @pre out.size() >= to.size()
+/// @param from the position.
+/// @param to the positions.
+/// @param out the distances.
+template <typename To, typename T>
+  requires std::same_as<typename To::dimension, Length> &&
+           std::same_as<typename To::value_type, T> && std::floating_point<T>
+void great_circle_distances(const LatLong<T> from,
+                            std::span<const LatLong<T>> to,
+                            std::span<To> out) noexcept {
+  great_circle_distance_matrix(std::span<const LatLong<T>>(&from, 1), to, out);
+}
+
+} // namespace geodesy
+} // namespace units
+} // namespace via
@@ -0,0 +1,564 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2024-2025 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief The International Standard Atmosphere (ISA).
+///
+/// The temperature, pressure, density and speed of sound of the ICAO
+/// Standard Atmosphere, see ICAO Doc 7488, as functions of geopotential
+/// altitude, through all its layers from mean sea level to 80 km.
+///
+/// The base temperature and pressure of every layer are calculated at
+/// compile time, so a lookup finds the layer and then evaluates a single
+/// linear, power or exponential function.
+/// The functions are constexpr: they use constexpr implementations of
+/// `exp`, `log` and `sqrt` in constant expressions and the `<cmath>`
+/// functions at run time.
+///
+/// The functions take an evaluation policy template parameter: `Exact`, the
+/// default, or `Fast`, which evaluates a polynomial from a table of 250 m
+/// altitude intervals instead of calling `exp` or `pow`, e.g.:
+/// `isa::pressure<isa::Fast>(altitude)`.
+//////////////////////////////////////////////////////////////////////////////
+#include "non_si.hpp"
+#include "simd.hpp"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+namespace via {
+namespace units {
+namespace isa {
+
+/// The standard acceleration due to gravity (g0) in m/s^2.
+template <typename T>
+  requires std::floating_point<T>
+constexpr T STANDARD_GRAVITY{static_cast<T>(9.806'65L)};
+
+/// The specific gas constant for dry air (R) in J/(kg K).
+template <typename T>
+  requires std::floating_point<T>
+constexpr T SPECIFIC_GAS_CONSTANT{static_cast<T>(287.052'87L)};
+
+/// The ratio of the specific heats of air (kappa).
+template <typename T>
+  requires std::floating_point<T>
+constexpr T RATIO_OF_SPECIFIC_HEATS{static_cast<T>(1.4L)};
+
+/// The temperature at mean sea level (T0).
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Kelvin<T> SEA_LEVEL_TEMPERATURE{static_cast<T>(288.15L)};
+
+/// The pressure at mean sea level (p0).
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Pascals<T> SEA_LEVEL_PRESSURE{static_cast<T>(101'325)};
+
+/// The maximum geopotential altitude of the ICAO Standard Atmosphere.
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Metres<T> MAXIMUM_ALTITUDE{static_cast<T>(80'000)};
+
+namespace detail {
+
+/// A constexpr exponential function.
+template <typename T>
+  requires std::floating_point<T>
+constexpr auto exp(const T x) noexcept -> T {
+  if consteval {
+    // exp(x) = 2^k * exp(r), where |r| <= ln(2) / 2
+    constexpr long double LN_2{0.693'147'180'559'945'309'417'232'121'458L};
+    const long double k_value{static_cast<long double>(x) / LN_2};
+    const long long k{static_cast<long long>(k_value < 0 ? k_value - 0.5L
+                                                         : k_value + 0.5L)};
+    const long double r{static_cast<long double>(x) - k * LN_2};
+
+    long double term{1};
+    long double sum{1};
+    for (int i{1}; i < 30; ++i) {
+      term *= r / i;
+      sum += term;
+    }
+    for (long long i{0}; i < k; ++i)
+      sum *= 2;
+    for (long long i{0}; i > k; --i)
+      sum /= 2;
+    return static_cast<T>(sum);
+  } else {
+    return std::exp(x);
+  }
+}
+
+/// A constexpr natural logarithm function.
+/// @pre x > 0
+template <typename T>
+  requires std::floating_point<T>
+constexpr auto log(const T x) noexcept -> T {
+  if consteval {
+    // log(x) = e * ln(2) + log(m), where 1 <= m < 2
+    constexpr long double LN_2{0.693'147'180'559'945'309'417'232'121'458L};
+    long double m{static_cast<long double>(x)};
+    int e{0};
+    for (; m >= 2; ++e)
+      m /= 2;
+    for (; m < 1; --e)
+      m *= 2;
+
+    // log(m) = 2 * atanh(z), where z = (m - 1) / (m + 1) <= 1/3
+    const long double z{(m - 1) / (m + 1)};
+    const long double z2{z * z};
+    long double term{z};
+    long double sum{0};
+    for (int i{1}; i < 80; i += 2) {
+      sum += term / i;
+      term *= z2;
+    }
+    return static_cast<T>(e * LN_2 + 2 * sum);
+  } else {
+    return std::log(x);
+  }
+}
+
+/// A constexpr power function.
+/// @pre x > 0
+template <typename T>
+  requires std::floating_point<T>
+constexpr auto pow(const T x, const T y) noexcept -> T {
+  if consteval {
+    return static_cast<T>(
+        exp<long double>(static_cast<long double>(y) *
+                         log<long double>(static_cast<long double>(x))));
+  } else {
+    return std::pow(x, y);
+  }
+}
+
+} // namespace detail
+
+/// A layer of the ICAO Standard Atmosphere.
+template <typename T>
+  requires std::floating_point<T>
+struct Layer {
+  /// The geopotential altitude of the base of the layer in metres.
+  T base_altitude;
+  /// The temperature at the base of the layer in Kelvin.
+  T base_temperature;
+  /// The temperature gradient in Kelvin per metre.
+  T lapse_rate;
+  /// The pressure at the base of the layer in Pascals.
+  T base_pressure;
+  /// The pressure exponent: -g0 / (lapse_rate R) in a gradient layer,
+  /// or -g0 / (base_temperature R) per metre in an isothermal layer.
+  T exponent;
+};
+
+namespace detail {
+
+/// The number of layers up to 80 km.
+constexpr std::size_t LAYER_COUNT{7};
+
+/// The base altitudes and temperature gradients of the layers,
+/// ICAO Doc 7488 Table D.
+constexpr std::array<std::array<long double, 2>, LAYER_COUNT> LAYER_DEFINITIONS{
+    {{0.0L, -0.006'5L},
+     {11'000.0L, 0.0L},
+     {20'000.0L, 0.001L},
+     {32'000.0L, 0.002'8L},
+     {47'000.0L, 0.0L},
+     {51'000.0L, -0.002'8L},
+     {71'000.0L, -0.002L}}};
+
+/// Calculate the layers, in long double, then round them to T.
+template <typename T>
+  requires std::floating_point<T>
+consteval auto calculate_layers() -> std::array<Layer<T>, LAYER_COUNT> {
+  const long double g0{STANDARD_GRAVITY<long double>};
+  const long double r{SPECIFIC_GAS_CONSTANT<long double>};
+
+  std::array<Layer<T>, LAYER_COUNT> layers{};
+  long double temperature{SEA_LEVEL_TEMPERATURE<long double>.v()};
+  long double pressure{SEA_LEVEL_PRESSURE<long double>.v()};
+  for (std::size_t i{0}; i < LAYER_COUNT; ++i) {
+    const auto [altitude, lapse_rate]{LAYER_DEFINITIONS[i]};
+    const long double exponent{lapse_rate == 0 ? -g0 / (temperature * r)
+                                               : -g0 / (lapse_rate * r)};
+    layers[i] = {static_cast<T>(altitude), static_cast<T>(temperature),
+                 static_cast<T>(lapse_rate), static_cast<T>(pressure),
+                 static_cast<T>(exponent)};
+
+    // Calculate the temperature and pressure at the base of the next layer
+    if (i + 1 < LAYER_COUNT) {
+      const long double height{LAYER_DEFINITIONS[i + 1][0] - altitude};
+      const long double top_temperature{temperature + lapse_rate * height};
+      pressure *= lapse_rate == 0 ? exp(exponent * height)
+                                  : pow(top_temperature / temperature, exponent);
+      temperature = top_temperature;
+    }
+  }
+  return layers;
+}
+
+} // namespace detail
+
+/// The layers of the ICAO Standard Atmosphere up to 80 km.
+template <typename T>
+  requires std::floating_point<T>
+constexpr std::array<Layer<T>, detail::LAYER_COUNT> LAYERS{
+    detail::calculate_layers<T>()};
+
+/// Find the layer of the ICAO Standard Atmosphere containing an altitude.
+/// Altitudes below mean sea level are in the first layer, altitudes above
+/// 80 km are in the last layer, i.e. the layer is extrapolated.
+/// @param altitude the geopotential altitude.
+/// @return the layer containing the altitude.
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto layer(const si::Metres<T> altitude) noexcept
+    -> const Layer<T> & {
+  std::size_t i{0};
+  for (std::size_t j{1}; j < detail::LAYER_COUNT; ++j)
+    i += LAYERS<T>[j].base_altitude <= altitude.v();
+  return LAYERS<T>[i];
+}
+
+/// The Exact evaluation policy: evaluate the layer functions, calling
+/// `exp` or `pow` to calculate pressure.
+struct Exact {};
+
+/// The Fast evaluation policy: evaluate piecewise polynomials from a
+/// cache-resident table, without calling `exp` or `pow`.
+/// Between FAST_MINIMUM_ALTITUDE and MAXIMUM_ALTITUDE the relative error of
+/// the pressure and density is less than FAST_MAXIMUM_RELATIVE_ERROR,
+/// outside of that range the Exact functions are evaluated.
+struct Fast {};
+
+/// An ISA evaluation policy: Exact or Fast.
+template <typename P>
+concept Policy = std::same_as<P, Exact> || std::same_as<P, Fast>;
+
+/// The minimum geopotential altitude of the Fast tables, the minimum
+/// altitude of the ICAO Doc 7488 tables.
+template <typename T>
+  requires std::floating_point<T>
+constexpr si::Metres<T> FAST_MINIMUM_ALTITUDE{static_cast<T>(-5'000)};
+
+/// The maximum relative error of the Fast pressure and density, compared
+/// with the Exact pressure and density.
+template <typename T>
+  requires std::floating_point<T>
+constexpr T FAST_MAXIMUM_RELATIVE_ERROR{
+    std::same_as<T, float> ? static_cast<T>(1e-6L)
+                             : static_cast<T>(1e-10L)};
+
+/// An altitude interval of the Fast tables.
+/// An interval lies within a single layer, so the temperature is linear
+/// and the pressure is a smooth function of the height above the middle of
+/// the interval, approximated by its Taylor polynomial.
+template <typename T>
+  requires std::floating_point<T>
+struct Interval {
+  /// The geopotential altitude of the middle of the interval in metres.
+  T altitude;
+  /// The temperature at the middle of the interval in Kelvin.
+  T temperature;
+  /// The temperature gradient in Kelvin per metre.
+  T lapse_rate;
+  /// The polynomial coefficients of pressure in Pascals, lowest degree first.
+  std::array<T, 5> pressure;
+};
+
+namespace detail {
+
+/// The height of an interval of the Fast tables in metres.
+constexpr long double FAST_INTERVAL_HEIGHT{250.0L};
+
+/// The number of intervals of the Fast tables, from -5 km to 80 km.
+/// The layer boundaries are multiples of FAST_INTERVAL_HEIGHT, so every
+/// interval lies within a single layer.
+constexpr std::size_t FAST_INTERVAL_COUNT{340};
+
+/// Calculate the intervals, in long double, then round them to T.
+template <typename T>
+  requires std::floating_point<T>
+consteval auto calculate_intervals()
+    -> std::array<Interval<T>, FAST_INTERVAL_COUNT> {
+  constexpr auto layers{calculate_layers<long double>()};
+
+  std::array<Interval<T>, FAST_INTERVAL_COUNT> intervals{};
+  for (std::size_t i{0}; i < FAST_INTERVAL_COUNT; ++i) {
+    const long double altitude{FAST_MINIMUM_ALTITUDE<long double>.v() +
+                               (i + 0.5L) * FAST_INTERVAL_HEIGHT};
+    std::size_t j{0};
+    for (std::size_t k{1}; k < LAYER_COUNT; ++k)
+      j += layers[k].base_altitude <= altitude;
+    const auto &l{layers[j]};
+
+    // The pressure and its Taylor coefficients at the middle of the interval:
+    // p(h) = p * exp(k h) in an isothermal layer,
+    // p(h) = p * (1 + lapse_rate h / temperature)^exponent otherwise.
+    const long double height{altitude - l.base_altitude};
+    const long double temperature{l.base_temperature + l.lapse_rate * height};
+    long double coefficient{
+        l.lapse_rate == 0
+            ? l.base_pressure * exp(l.exponent * height)
+            : l.base_pressure *
+                  pow(temperature / l.base_temperature, l.exponent)};
+
+    Interval<T> &interval{intervals[i]};
+    interval.altitude = static_cast<T>(altitude);
+    interval.temperature = static_cast<T>(temperature);
+    interval.lapse_rate = static_cast<T>(l.lapse_rate);
+    for (std::size_t n{0}; n < interval.pressure.size(); ++n) {
+      interval.pressure[n] = static_cast<T>(coefficient);
+      coefficient *= (l.lapse_rate == 0
+                          ? l.exponent
+                          : (l.exponent - n) * l.lapse_rate / temperature) /
+                     (n + 1);
+    }
+  }
+  return intervals;
+}
+
+} // namespace detail
+
+/// The intervals of the Fast tables, one cache line per interval in double.
+template <typename T>
+  requires std::floating_point<T>
+alignas(64) constexpr std::array<Interval<T>, detail::FAST_INTERVAL_COUNT>
+    FAST_INTERVALS{detail::calculate_intervals<T>()};
+
+/// Find the interval of the Fast tables containing an altitude.
+/// @param altitude the geopotential altitude.
+/// @return a pointer to the interval containing the altitude, nullptr if
+/// the altitude is outside of the Fast tables.
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto interval(const si::Metres<T> altitude) noexcept
+    -> const Interval<T> * {
+  const T x{(altitude.v() - FAST_MINIMUM_ALTITUDE<T>.v()) *
+            static_cast<T>(1 / detail::FAST_INTERVAL_HEIGHT)};
+  // Note: also rejects NaN
+  if (!(T() <= x && x < static_cast<T>(detail::FAST_INTERVAL_COUNT)))
+    return nullptr;
+  return &FAST_INTERVALS<T>[static_cast<std::size_t>(x)];
+}
+
+/// The temperature at a geopotential altitude.
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param altitude the geopotential altitude.
+/// @return the temperature.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto temperature(const si::Metres<T> altitude) noexcept
+    -> si::Kelvin<T> {
+  if constexpr (std::same_as<P, Fast>) {
+    if (const auto *i{interval(altitude)})
+      return si::Kelvin<T>(i->temperature +
+                           i->lapse_rate * (altitude.v() - i->altitude));
+  }
+
+  const auto &l{layer(altitude)};
+  return si::Kelvin<T>(l.base_temperature +
+                       l.lapse_rate * (altitude.v() - l.base_altitude));
+}
+
+/// The pressure at a geopotential altitude.
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param altitude the geopotential altitude.
+/// @return the pressure.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto pressure(const si::Metres<T> altitude) noexcept
+    -> si::Pascals<T> {
+  if constexpr (std::same_as<P, Fast>) {
+    if (const auto *i{interval(altitude)}) {
+      const T h{altitude.v() - i->altitude};
+      const auto &c{i->pressure};
+      return si::Pascals<T>(c[0] +
+                            h * (c[1] + h * (c[2] + h * (c[3] + h * c[4]))));
+    }
+  }
+
+  const auto &l{layer(altitude)};
+  const T height{altitude.v() - l.base_altitude};
+  if (l.lapse_rate == T())
+    return si::Pascals<T>(l.base_pressure * detail::exp(l.exponent * height));
+
+  const T temperature{l.base_temperature + l.lapse_rate * height};
+  return si::Pascals<T>(
+      l.base_pressure *
+      detail::pow(temperature / l.base_temperature, l.exponent));
+}
+
+/// The density of air at a temperature and pressure.
+/// @param temperature the temperature.
+/// @param pressure the pressure.
+/// @return the density.
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto density(const si::Kelvin<T> temperature,
+                       const si::Pascals<T> pressure) noexcept
+    -> si::KilogramsPerCubicMetre<T> {
+  return si::KilogramsPerCubicMetre<T>(
+      pressure.v() / (SPECIFIC_GAS_CONSTANT<T> * temperature.v()));
+}
+
+/// The density at a geopotential altitude.
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param altitude the geopotential altitude.
+/// @return the density.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto density(const si::Metres<T> altitude) noexcept
+    -> si::KilogramsPerCubicMetre<T> {
+  return density(temperature<P>(altitude), pressure<P>(altitude));
+}
+
+/// The speed of sound at a temperature.
+/// @param temperature the temperature.
+/// @return the speed of sound.
+template <typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto speed_of_sound(const si::Kelvin<T> temperature) noexcept
+    -> si::MetresPerSecond<T> {
+  return si::MetresPerSecond<T>(simd::Scalar<T>::sqrt(
+      RATIO_OF_SPECIFIC_HEATS<T> * SPECIFIC_GAS_CONSTANT<T> * temperature.v()));
+}
+
+/// The speed of sound at a geopotential altitude.
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param altitude the geopotential altitude.
+/// @return the speed of sound.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto speed_of_sound(const si::Metres<T> altitude) noexcept
+    -> si::MetresPerSecond<T> {
+  return speed_of_sound(temperature<P>(altitude));
+}
+
+/// The temperature at a geopotential altitude in Feet.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto temperature(const non_si::Feet<T> altitude) noexcept
+    -> si::Kelvin<T> {
+  return temperature<P>(altitude.to_metres());
+}
+
+/// The pressure at a geopotential altitude in Feet.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto pressure(const non_si::Feet<T> altitude) noexcept
+    -> si::Pascals<T> {
+  return pressure<P>(altitude.to_metres());
+}
+
+/// The density at a geopotential altitude in Feet.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto density(const non_si::Feet<T> altitude) noexcept
+    -> si::KilogramsPerCubicMetre<T> {
+  return density<P>(altitude.to_metres());
+}
+
+/// The speed of sound at a geopotential altitude in Feet.
+template <Policy P = Exact, typename T>
+  requires std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto speed_of_sound(const non_si::Feet<T> altitude) noexcept
+    -> si::MetresPerSecond<T> {
+  return speed_of_sound<P>(altitude.to_metres());
+}
+
+/// The temperature at geopotential altitudes.
+/// @pre out.size() >= in.size()
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param in the geopotential altitudes in Metres or Feet.
+/// @param out the temperatures.
+template <Policy P = Exact, typename A, typename T>
+  requires std::floating_point<T>
+void temperature(std::span<const A> in, std::span<si::Kelvin<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  for (std::size_t i{0}; i < in.size(); ++i)
+    out[i] = temperature<P>(in[i]);
+}
+
+/// The pressure at geopotential altitudes.
+/// @pre out.size() >= in.size()
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param in the geopotential altitudes in Metres or Feet.
+/// @param out the pressures.
+template <Policy P = Exact, typename A, typename T>
+  requires std::floating_point<T>
+void pressure(std::span<const A> in, std::span<si::Pascals<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  for (std::size_t i{0}; i < in.size(); ++i)
+    out[i] = pressure<P>(in[i]);
+}
+
+/// The density at geopotential altitudes.
+/// @pre out.size() >= in.size()
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param in the geopotential altitudes in Metres or Feet.
+/// @param out the densities.
+template <Policy P = Exact, typename A, typename T>
+  requires std::floating_point<T>
+void density(std::span<const A> in,
+             std::span<si::KilogramsPerCubicMetre<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  for (std::size_t i{0}; i < in.size(); ++i)
+    out[i] = density<P>(in[i]);
+}
+
+/// The speed of sound at geopotential altitudes.
+/// @pre out.size() >= in.size()
+/// @tparam P the evaluation policy, Exact or Fast.
+/// @param in the geopotential altitudes in Metres or Feet.
+/// @param out the speeds of sound.
+template <Policy P = Exact, typename A, typename T>
+  requires std::floating_point<T>
+void speed_of_sound(std::span<const A> in,
+                    std::span<si::MetresPerSecond<T>> out) noexcept {
+  assert(in.size() <= out.size());
+  for (std::size_t i{0}; i < in.size(); ++i)
+    out[i] = speed_of_sound<P>(in[i]);
+}
+
+} // namespace isa
+} // namespace units
+} // namespace via
@@ -0,0 +1,322 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Kinematic integration of positions and speeds over time.
+///
+/// The positions, speeds and accelerations may be in any units of length,
+/// speed and acceleration, e.g. NauticalMiles, Knots and
+/// MetresPerSecondSquared, and the time step in any unit of time.
+/// The factors between the units are calculated exactly from their ratios at
+/// compile time, so each step is a few multiplications and additions of the
+/// stored values, without converting them to SI units and back.
+///
+/// The batch `integrate` functions step spans of positions and speeds forward
+/// in place, in SIMD lanes, e.g. the along track distances and ground speeds,
+/// or the altitudes and vertical speeds, of every aircraft in a trajectory
+/// predictor. The results are bit-for-bit identical to the scalar `advance`
+/// and `accelerate` functions.
+//////////////////////////////////////////////////////////////////////////////
+#include "batch.hpp"
+#include "parallel.hpp"
+#include "quantity.hpp"
+#include "simd.hpp"
+#include "trace.hpp"
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <ratio>
+#include <span>
+
+namespace via {
+namespace units {
+namespace kinematics {
+
+/// A Unit of dimension D with a floating point value.
+template <typename U, typename D>
+concept UnitOf = Unit<U> && std::same_as<unit_dimension_t<U>, D> &&
+                 std::floating_point<unit_value_t<U>>;
+
+namespace detail {
+
+/// The factor to convert the product of values in units with the product
+/// Ratio R to unit To, e.g. Knots times Seconds to NauticalMiles.
+template <typename To, typename R>
+constexpr unit_value_t<To> product_factor{
+    conversion_factor<To, Quantity<unit_dimension_t<To>, R, unit_value_t<To>>>};
+
+/// The factor from a rate of change in units R, e.g. Knots, to the change
+/// in units To, e.g. NauticalMiles, over a time.
+template <typename To, typename R, typename Ti>
+[[nodiscard("Pure Function")]]
+constexpr auto rate_factor(const Ti time) noexcept -> unit_value_t<To> {
+  return product_factor<To,
+                        std::ratio_multiply<typename R::ratio,
+                                            typename Ti::ratio>> *
+         time.v();
+}
+
+/// The factor from an acceleration in units A to the displacement in units
+/// L over a time: t^2 / 2.
+template <typename L, typename A, typename Ti>
+[[nodiscard("Pure Function")]]
+constexpr auto acceleration_factor(const Ti time) noexcept
+    -> unit_value_t<L> {
+  using R = std::ratio_multiply<typename Ti::ratio, typename Ti::ratio>;
+  return unit_value_t<L>(0.5) *
+         product_factor<L, std::ratio_multiply<typename A::ratio, R>> *
+         time.v() * time.v();
+}
+
+/// Step a value x at a rate of change by the factor of a time step:
+/// x + rate * factor.
+/// Each step has a single multiplication and addition, so a compiler that
+/// contracts them into a fused multiply-add contracts the scalar and SIMD
+/// steps alike.
+template <typename V>
+[[nodiscard("Pure Function")]]
+constexpr auto step(const typename V::type x, const typename V::type rate,
+                    const typename V::type factor) noexcept ->
+    typename V::type {
+  return V::add(x, V::mul(rate, factor));
+}
+
+} // namespace detail
+
+/// The displacement at a constant speed over a time: v t.
+/// @param speed the speed.
+/// @param time the time.
+/// @return the displacement in units L, e.g. NauticalMiles.
+template <typename L, typename S, typename Ti,
+          typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> && std::same_as<unit_value_t<Ti>, T>
+[[nodiscard("Pure Function")]]
+constexpr auto displacement(const S speed, const Ti time) noexcept -> L {
+  return L(speed.v() * detail::rate_factor<L, S>(time));
+}
+
+/// The displacement at a constant acceleration over a time: v t + a t^2 / 2.
+/// @param speed the speed at the start of the time.
+/// @param acceleration the acceleration.
+/// @param time the time.
+/// @return the displacement in units L, e.g. NauticalMiles.
+template <typename L, typename S, typename A, typename Ti,
+          typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> &&
+           UnitOf<A, Acceleration> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> &&
+           std::same_as<unit_value_t<A>, T> && std::same_as<unit_value_t<Ti>, T>
+[[nodiscard("Pure Function")]]
+constexpr auto displacement(const S speed, const A acceleration,
+                            const Ti time) noexcept -> L {
+  return L(speed.v() * detail::rate_factor<L, S>(time) +
+           acceleration.v() * detail::acceleration_factor<L, A>(time));
+}
+
+/// Advance a position at a constant speed over a time: p + v t.
+/// @param position the position at the start of the time.
+/// @param speed the speed.
+/// @param time the time.
+/// @return the position at the end of the time.
+template <typename L, typename S, typename Ti, typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> && std::same_as<unit_value_t<Ti>, T>
+[[nodiscard("Pure Function")]]
+constexpr auto advance(const L position, const S speed, const Ti time) noexcept
+    -> L {
+  using V = simd::Scalar<T>;
+  return L(detail::step<V>(position.v(), speed.v(),
+                           detail::rate_factor<L, S>(time)));
+}
+
+/// Advance a position at a constant acceleration over a time:
+/// p + v t + a t^2 / 2.
+/// @param position the position at the start of the time.
+/// @param speed the speed at the start of the time.
+/// @param acceleration the acceleration.
+/// @param time the time.
+/// @return the position at the end of the time.
+template <typename L, typename S, typename A, typename Ti,
+          typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> &&
+           UnitOf<A, Acceleration> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> &&
+           std::same_as<unit_value_t<A>, T> && std::same_as<unit_value_t<Ti>, T>
+[[nodiscard("Pure Function")]]
+constexpr auto advance(const L position, const S speed, const A acceleration,
+                       const Ti time) noexcept -> L {
+  using V = simd::Scalar<T>;
+  return L(detail::step<V>(
+      detail::step<V>(position.v(), speed.v(),
+                      detail::rate_factor<L, S>(time)),
+      acceleration.v(), detail::acceleration_factor<L, A>(time)));
+}
+
+/// Accelerate a speed at a constant acceleration over a time: v + a t.
+/// @param speed the speed at the start of the time.
+/// @param acceleration the acceleration.
+/// @param time the time.
+/// @return the speed at the end of the time.
+template <typename S, typename A, typename Ti, typename T = unit_value_t<S>>
+  requires UnitOf<S, Speed> && UnitOf<A, Acceleration> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<A>, T> && std::same_as<unit_value_t<Ti>, T>
+[[nodiscard("Pure Function")]]
+constexpr auto accelerate(const S speed, const A acceleration,
+                          const Ti time) noexcept -> S {
+  using V = simd::Scalar<T>;
+  return S(detail::step<V>(speed.v(), acceleration.v(),
+                           detail::rate_factor<S, A>(time)));
+}
+
+/// Step positions forward in time at constant speeds.
+/// The results are bit-for-bit identical to `advance`.
+/// @pre speeds.size() >= positions.size()
+/// @param positions the positions, e.g. along track distances in
+/// NauticalMiles.
+/// @param speeds the speeds, e.g. ground speeds in Knots.
+/// @param time the time step.
+template <typename L, typename S, typename Ti, typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> && std::same_as<unit_value_t<Ti>, T>
+void integrate(std::span<L> positions, std::span<const S> speeds,
+               const Ti time) noexcept {
+  using V = simd::Lanes<T>;
+  using W = simd::Scalar<T>;
+  assert(positions.size() <= speeds.size());
+  VIA_UNITS_TRACE_CALL("integrate", positions.size(), S, L);
+  const auto n{positions.size()};
+  const auto p{units::detail::values<T>(positions).data()};
+  const auto v{units::detail::values<T>(speeds).data()};
+
+  const T c{detail::rate_factor<L, S>(time)};
+  const auto cv{V::broadcast(c)};
+  std::size_t i{0};
+  for (; i + V::size <= n; i += V::size)
+    V::store(p + i, detail::step<V>(V::load(p + i), V::load(v + i), cv));
+  for (; i < n; ++i)
+    p[i] = detail::step<W>(p[i], v[i], c);
+}
+
+/// Step positions and speeds forward in time at constant accelerations.
+/// The results are bit-for-bit identical to `advance` and `accelerate`.
+/// @pre speeds.size() >= positions.size() and
+/// accelerations.size() >= positions.size()
+/// @param positions the positions, e.g. altitudes in Feet.
+/// @param speeds the speeds, e.g. vertical speeds in FeetPerMinute.
+/// @param accelerations the accelerations.
+/// @param time the time step.
+template <typename L, typename S, typename A, typename Ti,
+          typename T = unit_value_t<L>>
+  requires UnitOf<L, Length> && UnitOf<S, Speed> &&
+           UnitOf<A, Acceleration> && UnitOf<Ti, Time> &&
+           std::same_as<unit_value_t<S>, T> &&
+           std::same_as<unit_value_t<A>, T> && std::same_as<unit_value_t<Ti>, T>
+void integrate(std::span<L> positions, std::span<S> speeds,
+               std::span<const A> accelerations, const Ti time) noexcept {
+  using V = simd::Lanes<T>;
+  using W = simd::Scalar<T>;
+  assert(positions.size() <= speeds.size() &&
+         positions.size() <= accelerations.size());
+  VIA_UNITS_TRACE_CALL("integrate", positions.size(), A, S, L);
+  const auto n{positions.size()};
+  const auto p{units::detail::values<T>(positions).data()};
+  const auto v{units::detail::values<T>(speeds).data()};
+  const auto a{units::detail::values<T>(accelerations).data()};
+
+  const T c_speed{detail::rate_factor<L, S>(time)};
+  const T c_acceleration{detail::acceleration_factor<L, A>(time)};
+  const T c_speed_change{detail::rate_factor<S, A>(time)};
+  const auto cv{V::broadcast(c_speed)};
+  const auto ca{V::broadcast(c_acceleration)};
+  const auto cs{V::broadcast(c_speed_change)};
+  std::size_t i{0};
+  for (; i + V::size <= n; i += V::size) {
+    const auto speed{V::load(v + i)};
+    const auto acceleration{V::load(a + i)};
+    V::store(p + i,
+             detail::step<V>(detail::step<V>(V::load(p + i), speed, cv),
+                             acceleration, ca));
+    V::store(v + i, detail::step<V>(speed, acceleration, cs));
+  }
+  for (; i < n; ++i) {
+    p[i] = detail::step<W>(detail::step<W>(p[i], v[i], c_speed), a[i],
+                           c_acceleration);
+    v[i] = detail::step<W>(v[i], a[i], c_speed_change);
+  }
+}
+
+/// Step positions forward in time at constant speeds, with an execution
+/// policy.
+/// @pre speeds.size() >= positions.size()
+/// @param policy the execution policy.
+/// @param positions the positions.
+/// @param speeds the speeds.
+/// @param time the time step.
+template <ExecutionPolicy P, typename L, typename S, typename Ti>
+  requires requires(std::span<L> positions, std::span<const S> speeds,
+                    const Ti time) { integrate(positions, speeds, time); }
+void integrate(const P &policy, std::span<L> positions,
+               std::span<const S> speeds, const Ti time) {
+  assert(positions.size() <= speeds.size());
+  units::detail::for_each_chunk<unit_value_t<L>>(
+      policy, positions.size(),
+      [positions, speeds, time](const std::size_t first,
+                                const std::size_t count) {
+        integrate(positions.subspan(first, count),
+                  speeds.subspan(first, count), time);
+      });
+}
+
+/// Step positions and speeds forward in time at constant accelerations,
+/// with an execution policy.
+/// @pre speeds.size() >= positions.size() and
+/// accelerations.size() >= positions.size()
+/// @param policy the execution policy.
+/// @param positions the positions.
+/// @param speeds the speeds.
+/// @param accelerations the accelerations.
+/// @param time the time step.
+template <ExecutionPolicy P, typename L, typename S, typename A,
+          typename Ti>
+  requires requires(std::span<L> positions, std::span<S> speeds,
+                    std::span<const A> accelerations, const Ti time) {
+    integrate(positions, speeds, accelerations, time);
+  }
+void integrate(const P &policy, std::span<L> positions, std::span<S> speeds,
+               std::span<const A> accelerations, const Ti time) {
+  assert(positions.size() <= speeds.size() &&
+         positions.size() <= accelerations.size());
+  units::detail::for_each_chunk<unit_value_t<L>>(
+      policy, positions.size(),
+      [positions, speeds, accelerations, time](const std::size_t first,
+                                               const std::size_t count) {
+        integrate(positions.subspan(first, count),
+                  speeds.subspan(first, count),
+                  accelerations.subspan(first, count), time);
+      });
+}
+
+} // namespace kinematics
+} // namespace units
+} // namespace via
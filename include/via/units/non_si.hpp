@@ -36,65 +36,8 @@ template <typename T>
   requires std::floating_point<T>
 constexpr T METRES_PER_NAUTICAL_MILE{static_cast<T>(1'852)};
 
-/// The NauticalMiles type for representing distance.
-template <typename T>
-  requires std::floating_point<T>
-class NauticalMiles final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit NauticalMiles(const T value) noexcept : v_{value} {}
-
-  /// Constructor from Metres
-  constexpr explicit NauticalMiles(const si::Metres<T> value) noexcept
-      : v_{value.v() / METRES_PER_NAUTICAL_MILE<T>} {}
-
-  /// Convert to Metres
-  constexpr auto to_metres() const noexcept -> si::Metres<T> {
-    return si::Metres<T>(METRES_PER_NAUTICAL_MILE<T> * v_);
-  }
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering
-  operator<=>(const NauticalMiles<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a NauticalMiles.
-  /// I.e.: NauticalMiles(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "NauticalMiles(" + std::to_string(v_) + ")";
-  }
-}; // NauticalMiles
-
-/// NauticalMiles equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const NauticalMiles<T> &lhs,
-                          const NauticalMiles<T> &rhs) noexcept -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// NauticalMiles ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const NauticalMiles<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+/// The ratio of a Nautical Mile to a metre.
+using NauticalMileRatio = std::ratio<1'852>;
 
 /// The length of a foot (ft) in metres (m).
 /// Definition from ICAO Annex 5 Table 3-3.
@@ -102,62 +45,20 @@ template <typename T>
   requires std::floating_point<T>
 constexpr T METRES_PER_FOOT{static_cast<T>(0.3048L)};
 
-/// The Feet type for representing altitude.
-template <typename T>
-  requires std::floating_point<T>
-class Feet final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Feet(const T value) noexcept : v_{value} {}
-
-  /// Constructor from Metres
-  constexpr explicit Feet(const si::Metres<T> value) noexcept
-      : v_{value.v() / METRES_PER_FOOT<T>} {}
-
-  /// Convert to Metres
-  constexpr auto to_metres() const noexcept -> si::Metres<T> {
-    return si::Metres<T>(METRES_PER_FOOT<T> * v_);
-  }
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Feet<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a Feet.
-  /// I.e.: Feet(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const { return "Feet(" + std::to_string(v_) + ")"; }
-}; // Feet
-
-/// Feet equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Feet<T> &lhs, const Feet<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
+/// The ratio of a foot to a metre.
+using FootRatio = std::ratio<3'048, 10'000>::type;
 
-/// Feet ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Feet<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+/// The ratio of a flight level, a hundred feet, to a metre.
+using FlightLevelRatio = std::ratio_multiply<FootRatio, std::ratio<100>>;
+
+/// The ratio of a minute to a second.
+using MinuteRatio = std::ratio<60>;
+
+/// The ratio of an hour to a second.
+using HourRatio = std::ratio<3'600>;
+
+/// The ratio of a foot per minute to a metre per second.
+using FootPerMinuteRatio = std::ratio_divide<FootRatio, MinuteRatio>;
 
 /// The conversion factor to Knots (kt) from metres per second (m/s).
 /// Calculated from `METRES_PER_NAUTICAL_MILE` / seconds in an hour,
@@ -167,65 +68,102 @@ template <typename T>
 constexpr T METRES_PER_SECOND_TO_KNOTS{METRES_PER_NAUTICAL_MILE<T> /
                                        static_cast<T>(3'600)};
 
+/// The ratio of a Knot to a metre per second.
+using KnotRatio = std::ratio_divide<NauticalMileRatio, std::ratio<3'600>>;
+
+} // namespace non_si
+
+template <>
+constexpr const char *unit_name<Length, non_si::NauticalMileRatio>{
+    "NauticalMiles"};
+template <>
+constexpr const char *unit_name<Length, non_si::FootRatio>{"Feet"};
+template <>
+constexpr const char *unit_name<Speed, non_si::KnotRatio>{"Knots"};
+template <>
+constexpr const char *unit_name<Length, non_si::FlightLevelRatio>{
+    "FlightLevels"};
+template <>
+constexpr const char *unit_name<Time, non_si::MinuteRatio>{"Minutes"};
+template <> constexpr const char *unit_name<Time, non_si::HourRatio>{"Hours"};
+template <>
+constexpr const char *unit_name<Speed, non_si::FootPerMinuteRatio>{
+    "FeetPerMinute"};
+
+template <>
+constexpr const char *unit_symbol<Length, non_si::NauticalMileRatio>{"NM"};
+template <> constexpr const char *unit_symbol<Length, non_si::FootRatio>{"ft"};
+template <> constexpr const char *unit_symbol<Speed, non_si::KnotRatio>{"kt"};
+template <>
+constexpr const char *unit_symbol<Length, non_si::FlightLevelRatio>{"FL"};
+template <>
+constexpr const char *unit_symbol<Time, non_si::MinuteRatio>{"min"};
+template <> constexpr const char *unit_symbol<Time, non_si::HourRatio>{"h"};
+template <>
+constexpr const char *unit_symbol<Speed, non_si::FootPerMinuteRatio>{
+    "ft/min"};
+
+namespace non_si {
+
+/// The NauticalMiles type for representing distance.
+template <typename T>
+  requires Representation<T>
+using NauticalMiles = Quantity<Length, NauticalMileRatio, T>;
+
+/// The Feet type for representing altitude.
+template <typename T>
+  requires Representation<T>
+using Feet = Quantity<Length, FootRatio, T>;
+
+/// The FlightLevels type for representing pressure altitude in hundreds of
+/// feet, e.g. `FlightLevels<std::int16_t>(350)` is FL350.
+template <typename T>
+  requires Representation<T>
+using FlightLevels = Quantity<Length, FlightLevelRatio, T>;
+
 /// The Knots type  for representing speed.
 template <typename T>
-  requires std::floating_point<T>
-class Knots final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Knots(const T value) noexcept : v_{value} {}
-
-  /// Constructor from MetresPerSecond
-  constexpr explicit Knots(const si::MetresPerSecond<T> value) noexcept
-      : v_{value.v() / METRES_PER_SECOND_TO_KNOTS<T>} {}
-
-  /// Convert to Metres
-  constexpr auto to_metres_per_second() const noexcept
-      -> si::MetresPerSecond<T> {
-    return si::MetresPerSecond<T>(METRES_PER_SECOND_TO_KNOTS<T> * v_);
-  }
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Knots<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a Knots.
-  /// I.e.: Knots(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "Knots(" + std::to_string(v_) + ")";
-  }
-}; // Knots
-
-/// Knots equality operator
+  requires Representation<T>
+using Knots = Quantity<Speed, KnotRatio, T>;
+
+/// The Minutes type for representing time.
 template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Knots<T> &lhs, const Knots<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
+  requires Representation<T>
+using Minutes = Quantity<Time, MinuteRatio, T>;
 
-/// Knots ostream << operator
+/// The Hours type for representing time, e.g. `Knots<double>(480) *
+/// Hours<double>(2)` is `NauticalMiles<double>(960)`.
 template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Knots<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using Hours = Quantity<Time, HourRatio, T>;
+
+/// The FeetPerMinute type for representing vertical speed.
+template <typename T>
+  requires Representation<T>
+using FeetPerMinute = Quantity<Speed, FootPerMinuteRatio, T>;
+
+// Every non-SI unit has the size, alignment and layout of its value.
+static_assert(detail::is_unit_template<NauticalMiles> &&
+              detail::is_unit_template<Feet> &&
+              detail::is_unit_template<FlightLevels> &&
+              detail::is_unit_template<Knots> &&
+              detail::is_unit_template<Minutes> &&
+              detail::is_unit_template<Hours> &&
+              detail::is_unit_template<FeetPerMinute>);
+
+// Speeds multiplied by times are the distances of the same units.
+static_assert(std::same_as<NauticalMiles<double>,
+                           decltype(Knots<double>() * Hours<double>())>);
+static_assert(std::same_as<Feet<double>, decltype(FeetPerMinute<double>() *
+                                                  Minutes<double>())>);
+
+// The conversions must be bit-for-bit identical to the constants above.
+static_assert(NauticalMiles<double>::si_factor ==
+              METRES_PER_NAUTICAL_MILE<double>);
+static_assert(Feet<double>::si_factor == METRES_PER_FOOT<double>);
+static_assert(Feet<float>::si_factor == METRES_PER_FOOT<float>);
+static_assert(Knots<double>::si_factor == METRES_PER_SECOND_TO_KNOTS<double>);
+static_assert(Knots<float>::si_factor == METRES_PER_SECOND_TO_KNOTS<float>);
 
 } // namespace non_si
 } // namespace units
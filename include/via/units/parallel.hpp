@@ -0,0 +1,283 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Execution policies and a thread pool for the batch functions.
+///
+/// The batch functions in batch.hpp accept an execution policy:
+/// - `Sequenced` runs them on the calling thread,
+/// - `Parallel` splits inputs of at least `threshold` elements into chunks
+/// and runs the chunks on a `ThreadPool`, otherwise it runs them on the
+/// calling thread.
+///
+/// Each thread of a pool owns a contiguous range of the chunks, so a thread
+/// converts neighbouring memory, which the first touch policy of the
+/// operating system usually places on the thread's NUMA node if the memory
+/// was written by the same partition. A thread that finishes its own chunks
+/// steals the remaining chunks of the other threads.
+/// Chunks are a 4096 byte page multiple of input, so chunk boundaries are
+/// page multiples from the start of an output of 2, 4 or 8 byte units.
+/// Threads only share the output at the boundaries: no cache lines if the
+/// output is aligned to a cache line, e.g. a `UnitColumn`, and no pages if
+/// it is page aligned. Otherwise neighbouring threads may share a cache
+/// line and a page at each boundary.
+//////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace via {
+namespace units {
+
+/// The default minimum number of elements for a `Parallel` batch function
+/// to use more than one thread: smaller inputs take less time to convert
+/// than to wake the threads of a pool.
+constexpr std::size_t PARALLEL_THRESHOLD{std::size_t(1) << 16};
+
+/// The size of the chunks of a parallel batch function, in bytes of input:
+/// a multiple of the page size.
+constexpr std::size_t PARALLEL_CHUNK_BYTES{std::size_t(64) << 10};
+
+/// A pool of threads for running the chunks of parallel batch functions.
+/// The calling thread runs chunks too, so a pool of n threads creates
+/// n - 1 worker threads.
+class ThreadPool final {
+  /// The chunks of the current loop owned by a thread.
+  struct alignas(64) Range {
+    std::atomic<std::size_t> next{0};
+    std::size_t end{0};
+  };
+
+  std::vector<std::thread> workers_;
+  std::unique_ptr<Range[]> ranges_;
+  /// Serialises the loops of threads that share the pool.
+  std::mutex mutex_;
+  /// Incremented to start a loop or to stop the workers.
+  std::atomic<std::uint64_t> generation_{0};
+  /// The number of workers still running the current loop.
+  std::atomic<std::size_t> active_{0};
+  bool stop_{false};
+
+  /// The current loop: calls function(context, chunk) for each chunk.
+  void (*function_)(void *, std::size_t){nullptr};
+  void *context_{nullptr};
+
+  /// Whether the current thread is running the chunks of a loop, i.e. it is
+  /// a worker of a pool or a thread inside `for_each`.
+  static auto in_loop() noexcept -> bool & {
+    thread_local bool running{false};
+    return running;
+  }
+
+  /// Run the chunks owned by thread index, then steal the chunks of the
+  /// other threads.
+  void run_chunks(const std::size_t index) noexcept {
+    const auto threads{size()};
+    for (std::size_t i{0}; i < threads; ++i) {
+      auto &range{ranges_[(index + i) % threads]};
+      for (auto chunk{range.next.fetch_add(1, std::memory_order_relaxed)};
+           chunk < range.end;
+           chunk = range.next.fetch_add(1, std::memory_order_relaxed))
+        function_(context_, chunk);
+    }
+  }
+
+  /// The worker thread function.
+  void work(const std::size_t index) noexcept {
+    in_loop() = true;
+    std::uint64_t generation{0};
+    for (;;) {
+      generation_.wait(generation, std::memory_order_acquire);
+      generation = generation_.load(std::memory_order_acquire);
+      if (stop_)
+        return;
+
+      run_chunks(index);
+      if (active_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        active_.notify_one();
+    }
+  }
+
+public:
+  /// Constructor
+  /// @param threads the number of threads, including the calling thread.
+  explicit ThreadPool(const std::size_t threads =
+                          std::max(1u, std::thread::hardware_concurrency()))
+      : ranges_{std::make_unique<Range[]>(std::max<std::size_t>(threads, 1))} {
+    for (std::size_t i{1}; i < threads; ++i)
+      workers_.emplace_back([this, i] { work(i); });
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  auto operator=(const ThreadPool &) -> ThreadPool & = delete;
+
+  /// Destructor: stops and joins the worker threads.
+  ~ThreadPool() {
+    stop_ = true;
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+    for (auto &worker : workers_)
+      worker.join();
+  }
+
+  /// The number of threads, including the calling thread.
+  [[nodiscard]]
+  auto size() const noexcept -> std::size_t {
+    return workers_.size() + 1;
+  }
+
+  /// The default pool, with a thread for each hardware thread.
+  static auto instance() -> ThreadPool & {
+    static ThreadPool pool;
+    return pool;
+  }
+
+  /// Call f(chunk) for each chunk in [0, chunks), on the threads of the pool.
+  /// Returns when every chunk has been run.
+  /// A loop started from inside another loop, by a worker or by the calling
+  /// thread of the other loop, runs on the current thread.
+  /// @param chunks the number of chunks.
+  /// @param f the function to call for each chunk: it must not throw.
+  template <typename F>
+    requires std::invocable<F &, std::size_t>
+  void for_each(const std::size_t chunks, F f) {
+    if (workers_.empty() || chunks < 2 || in_loop()) {
+      for (std::size_t chunk{0}; chunk < chunks; ++chunk)
+        f(chunk);
+      return;
+    }
+
+    const std::lock_guard lock{mutex_};
+    const auto threads{size()};
+    for (std::size_t i{0}; i < threads; ++i) {
+      ranges_[i].next.store(i * chunks / threads, std::memory_order_relaxed);
+      ranges_[i].end = (i + 1) * chunks / threads;
+    }
+    function_ = [](void *context, const std::size_t chunk) {
+      (*static_cast<F *>(context))(chunk);
+    };
+    context_ = &f;
+
+    active_.store(workers_.size(), std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+
+    // The calling thread runs the first range of chunks.
+    in_loop() = true;
+    run_chunks(0);
+    in_loop() = false;
+    for (auto active{active_.load(std::memory_order_acquire)}; active != 0;
+         active = active_.load(std::memory_order_acquire))
+      active_.wait(active, std::memory_order_acquire);
+  }
+};
+
+/// The sequenced execution policy: the batch functions run on the calling
+/// thread.
+struct Sequenced {};
+
+/// The parallel execution policy: the batch functions run on the threads of
+/// a `ThreadPool`, if the input has at least `threshold` elements.
+struct Parallel {
+  /// The minimum number of elements to run on more than one thread.
+  std::size_t threshold{PARALLEL_THRESHOLD};
+  /// The thread pool, nullptr for `ThreadPool::instance()`.
+  ThreadPool *pool{nullptr};
+};
+
+/// An execution policy of the batch functions.
+template <typename P>
+concept ExecutionPolicy =
+    std::same_as<P, Sequenced> || std::same_as<P, Parallel>;
+
+/// The sequenced execution policy.
+inline constexpr Sequenced seq{};
+
+/// The parallel execution policy, with the default threshold and pool.
+inline constexpr Parallel par{};
+
+namespace detail {
+
+/// The chunks of a batch function.
+struct Chunks {
+  /// The number of elements in each chunk, except the last.
+  std::size_t size;
+  /// The number of chunks.
+  std::size_t count;
+};
+
+/// Split size elements of type T into chunks of PARALLEL_CHUNK_BYTES.
+/// A `Sequenced` batch function, or one with fewer than `threshold`
+/// elements, has a single chunk.
+/// @param policy the execution policy.
+/// @param size the number of elements.
+/// @return the chunks.
+template <typename T, ExecutionPolicy P>
+[[nodiscard("Pure Function")]]
+constexpr auto chunks(const P &policy, const std::size_t size) noexcept
+    -> Chunks {
+  if constexpr (std::same_as<P, Parallel>) {
+    if (size >= policy.threshold) {
+      constexpr std::size_t chunk_size{
+          std::max<std::size_t>(PARALLEL_CHUNK_BYTES / sizeof(T), 1)};
+      return {chunk_size, (size + chunk_size - 1) / chunk_size};
+    }
+  }
+  return {size, size ? 1u : 0u};
+}
+
+/// Call f(first, count) for each chunk of a batch function of size
+/// elements of type T, on the calling thread or the threads of the policy.
+/// @param policy the execution policy.
+/// @param size the number of elements.
+/// @param f the function to call for each chunk: it must not throw.
+template <typename T, ExecutionPolicy P, typename F>
+void for_each_chunk(const P &policy, const std::size_t size, F f) {
+  const auto [chunk_size, count]{chunks<T>(policy, size)};
+  const auto run{[&](const std::size_t chunk) {
+    const auto first{chunk * chunk_size};
+    f(first, std::min(chunk_size, size - first));
+  }};
+
+  if constexpr (std::same_as<P, Parallel>) {
+    if (count > 1) {
+      auto &pool{policy.pool ? *policy.pool : ThreadPool::instance()};
+      pool.for_each(count, run);
+      return;
+    }
+  }
+  if (count)
+    run(0);
+}
+
+} // namespace detail
+} // namespace units
+} // namespace via
@@ -0,0 +1,288 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Parse units from text, e.g.: "FL350", "250kt", "5000ft", "12.5NM".
+///
+/// The values are parsed with `std::from_chars`, so parsing is locale
+/// independent and does not allocate memory.
+/// A value may be followed by an ICAO Annex 5 unit symbol, optionally
+/// separated by a single space:
+/// - "m" for Metres,
+/// - "ft" or "FT" for Feet,
+/// - "NM" for NauticalMiles,
+/// - "kt" or "KT" for Knots.
+///
+/// A flight level, e.g. "FL350", is an altitude in hundreds of Feet.
+//////////////////////////////////////////////////////////////////////////////
+#include "non_si.hpp"
+#include <charconv>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <variant>
+
+namespace via {
+namespace units {
+
+/// A value parsed from text, in the unit of its unit symbol.
+template <typename T>
+  requires std::floating_point<T>
+using ParsedUnit = std::variant<si::Metres<T>, non_si::Feet<T>,
+                                non_si::NauticalMiles<T>, non_si::Knots<T>>;
+
+/// The result of parsing a column of values.
+struct ColumnResult {
+  /// The number of values parsed.
+  std::size_t count;
+  /// The end of the text or, on error, the start of the failing value or
+  /// of the unexpected characters after a value.
+  const char *ptr;
+  /// std::errc() on success, std::errc::value_too_large if there are more
+  /// values than the output span, otherwise the error of the failing value.
+  std::errc ec;
+};
+
+namespace detail {
+
+/// The unit symbols.
+enum class Symbol { None, Metres, Feet, FlightLevel, NauticalMiles, Knots };
+
+/// Whether a character is an ASCII letter.
+constexpr auto is_letter(const char c) noexcept -> bool {
+  return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+}
+
+/// Whether a character may continue a value, i.e. it is a letter, a digit
+/// or a decimal point.
+constexpr auto is_value_char(const char c) noexcept -> bool {
+  return is_letter(c) || ('0' <= c && c <= '9') || c == '.';
+}
+
+/// Find the unit symbol of a string of letters.
+constexpr auto find_symbol(const std::string_view letters) noexcept -> Symbol {
+  if (letters == "m")
+    return Symbol::Metres;
+  if (letters == "ft" || letters == "FT")
+    return Symbol::Feet;
+  if (letters == "NM")
+    return Symbol::NauticalMiles;
+  if (letters == "kt" || letters == "KT")
+    return Symbol::Knots;
+  return Symbol::None;
+}
+
+/// Parse a value and its unit symbol.
+/// @return the result, as `std::from_chars`.
+template <typename T>
+  requires std::floating_point<T>
+auto parse_value(const char *first, const char *last, T &value,
+                 Symbol &symbol) noexcept -> std::from_chars_result {
+  const std::from_chars_result invalid{first, std::errc::invalid_argument};
+
+  if (last - first > 2 && first[0] == 'F' && first[1] == 'L') {
+    unsigned level{};
+    const auto result{std::from_chars(first + 2, last, level)};
+    if (result.ec != std::errc())
+      return result.ec == std::errc::invalid_argument ? invalid : result;
+    if (result.ptr != last && is_value_char(*result.ptr))
+      return invalid;
+
+    value = static_cast<T>(100) * static_cast<T>(level);
+    symbol = Symbol::FlightLevel;
+    return result;
+  }
+
+  auto result{std::from_chars(first, last, value)};
+  if (result.ec != std::errc())
+    return result;
+
+  symbol = Symbol::None;
+  const char *p{result.ptr};
+  if (p != last && *p == ' ' && p + 1 != last && is_letter(p[1]))
+    ++p;
+  if (p != last && is_letter(*p)) {
+    const char *const letters{p};
+    while (p != last && is_letter(*p))
+      ++p;
+    symbol = find_symbol({letters, p});
+    if (symbol == Symbol::None)
+      return invalid;
+    result.ptr = p;
+  }
+  if (result.ptr != last && is_value_char(*result.ptr))
+    return invalid;
+  return result;
+}
+
+/// Assign a value in unit From to a Quantity of the same dimension.
+/// @return false if the dimensions differ.
+template <typename From, typename To>
+constexpr auto assign(const typename To::value_type value, To &out) noexcept
+    -> bool {
+  if constexpr (std::same_as<typename From::dimension,
+                             typename To::dimension>) {
+    out = convert<To>(From(value));
+    return true;
+  } else {
+    return false;
+  }
+}
+
+/// Whether a character is a space, tab, carriage return or newline.
+constexpr auto is_space(const char c) noexcept -> bool {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/// Skip spaces, tabs and carriage returns, unless they are the delimiter.
+constexpr auto skip_blanks(const char *p, const char *last,
+                           const char delimiter) noexcept -> const char * {
+  while (p != last && *p != delimiter &&
+         (*p == ' ' || *p == '\t' || *p == '\r'))
+    ++p;
+  return p;
+}
+
+} // namespace detail
+
+/// Parse a value with a unit symbol, e.g. "250kt", or a flight level,
+/// e.g. "FL350".
+/// @param first, last the text to parse.
+/// @param value the parsed value, in the unit of its unit symbol.
+/// @return the result, as `std::from_chars`:
+/// std::errc::invalid_argument if the text does not start with a value
+/// and a unit symbol.
+template <typename T>
+  requires std::floating_point<T>
+auto from_chars(const char *first, const char *last,
+                ParsedUnit<T> &value) noexcept -> std::from_chars_result {
+  T v{};
+  detail::Symbol symbol{};
+  const auto result{detail::parse_value(first, last, v, symbol)};
+  if (result.ec != std::errc())
+    return result;
+
+  switch (symbol) {
+  case detail::Symbol::Metres:
+    value.template emplace<si::Metres<T>>(v);
+    break;
+  case detail::Symbol::Feet:
+  case detail::Symbol::FlightLevel:
+    value.template emplace<non_si::Feet<T>>(v);
+    break;
+  case detail::Symbol::NauticalMiles:
+    value.template emplace<non_si::NauticalMiles<T>>(v);
+    break;
+  case detail::Symbol::Knots:
+    value.template emplace<non_si::Knots<T>>(v);
+    break;
+  default:
+    return {first, std::errc::invalid_argument};
+  }
+  return result;
+}
+
+/// Parse a Quantity, e.g. Feet from "5000", "5000ft", "FL50" or "1524m".
+/// A value without a unit symbol is in the unit of the Quantity, a value
+/// with a unit symbol of the same dimension is converted with `convert`.
+/// @param first, last the text to parse.
+/// @param value the parsed Quantity.
+/// @return the result, as `std::from_chars`:
+/// std::errc::invalid_argument if the text does not start with a value or
+/// its unit symbol has a different dimension.
+template <typename D, typename R, typename T>
+auto from_chars(const char *first, const char *last,
+                Quantity<D, R, T> &value) noexcept -> std::from_chars_result {
+  using To = Quantity<D, R, T>;
+  T v{};
+  detail::Symbol symbol{};
+  const auto result{detail::parse_value(first, last, v, symbol)};
+  if (result.ec != std::errc())
+    return result;
+
+  bool ok{false};
+  switch (symbol) {
+  case detail::Symbol::None:
+    value = To(v);
+    ok = true;
+    break;
+  case detail::Symbol::Metres:
+    ok = detail::assign<si::Metres<T>>(v, value);
+    break;
+  case detail::Symbol::Feet:
+  case detail::Symbol::FlightLevel:
+    ok = detail::assign<non_si::Feet<T>>(v, value);
+    break;
+  case detail::Symbol::NauticalMiles:
+    ok = detail::assign<non_si::NauticalMiles<T>>(v, value);
+    break;
+  case detail::Symbol::Knots:
+    ok = detail::assign<non_si::Knots<T>>(v, value);
+    break;
+  }
+  return ok ? result
+            : std::from_chars_result{first, std::errc::invalid_argument};
+}
+
+/// Parse a column of Quantities, without allocating memory.
+/// The values are separated by a delimiter or a newline, blanks around the
+/// values are ignored, e.g. "FL350, 5000ft, 1524 m\n".
+/// Each value is parsed by `from_chars` into a Quantity.
+/// @param text the column.
+/// @param out the parsed Quantities.
+/// @param delimiter the delimiter between values.
+/// @return the number of values parsed and, on error, the position of the
+/// failing value and the error.
+template <typename D, typename R, typename T>
+auto parse_column(const std::string_view text,
+                  std::span<Quantity<D, R, T>> out,
+                  const char delimiter = ',') noexcept -> ColumnResult {
+  const char *const last{text.data() + text.size()};
+  const char *p{text.data()};
+  while (p != last && detail::is_space(*p))
+    ++p;
+
+  std::size_t count{0};
+  while (p != last) {
+    if (count == out.size())
+      return {count, p, std::errc::value_too_large};
+    const auto result{from_chars(p, last, out[count])};
+    if (result.ec != std::errc())
+      return {count, p, result.ec};
+    ++count;
+
+    p = detail::skip_blanks(result.ptr, last, delimiter);
+    if (p == last)
+      break;
+    if (*p != delimiter && *p != '\n')
+      return {count, p, std::errc::invalid_argument};
+    ++p;
+    while (p != last && detail::is_space(*p))
+      ++p;
+  }
+  return {count, p, std::errc()};
+}
+
+} // namespace units
+} // namespace via
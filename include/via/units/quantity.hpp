@@ -0,0 +1,551 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2024-2025 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief A generic quantity type with compile-time dimensional analysis.
+///
+/// A Quantity encodes the exponents of its dimension and its scale relative
+/// to SI units in its type, so multiplying and dividing quantities produces
+/// the correctly dimensioned type at compile time, e.g.:
+/// Metres / Seconds -> MetresPerSecond.
+/// A Quantity holds a single value and every operation is a single floating
+/// point operation on it, so there is no overhead compared to raw values.
+///
+/// The value may also be a signed integer, for compact storage in whole
+/// multiples of the unit, e.g. `Feet<std::int32_t>` or
+/// `FlightLevels<std::int16_t>`. Integer quantities can be added, subtracted
+/// and compared; `convert` widens them to floating point units for
+/// calculations.
+///
+/// The `Unit` concept and `unit_traits` describe any Quantity, so that
+/// generic algorithms can be written once for every unit, e.g. a SIMD kernel
+/// on the values of a span of units.
+//////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ostream>
+#include <ratio>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+
+namespace via {
+namespace units {
+
+/// The exponents of the base dimensions of a quantity.
+template <int Length, int Mass, int Time, int Temperature> struct Dimension {
+  static constexpr int length{Length};
+  static constexpr int mass{Mass};
+  static constexpr int time{Time};
+  static constexpr int temperature{Temperature};
+};
+
+namespace detail {
+template <typename A, typename B> struct dimension_product;
+
+template <int L1, int M1, int Ti1, int Th1, int L2, int M2, int Ti2, int Th2>
+struct dimension_product<Dimension<L1, M1, Ti1, Th1>,
+                         Dimension<L2, M2, Ti2, Th2>> {
+  using type = Dimension<L1 + L2, M1 + M2, Ti1 + Ti2, Th1 + Th2>;
+};
+
+template <typename A> struct dimension_inverse;
+
+template <int L, int M, int Ti, int Th>
+struct dimension_inverse<Dimension<L, M, Ti, Th>> {
+  using type = Dimension<-L, -M, -Ti, -Th>;
+};
+} // namespace detail
+
+/// The dimension of the product of quantities with dimensions A and B.
+template <typename A, typename B>
+using dimension_multiply = typename detail::dimension_product<A, B>::type;
+
+/// The dimension of the quotient of quantities with dimensions A and B.
+template <typename A, typename B>
+using dimension_divide =
+    dimension_multiply<A, typename detail::dimension_inverse<B>::type>;
+
+using Dimensionless = Dimension<0, 0, 0, 0>;
+using Length = Dimension<1, 0, 0, 0>;
+using Mass = Dimension<0, 1, 0, 0>;
+using Time = Dimension<0, 0, 1, 0>;
+using Temperature = Dimension<0, 0, 0, 1>;
+using Speed = dimension_divide<Length, Time>;
+using Acceleration = dimension_divide<Speed, Time>;
+using Volume = dimension_multiply<Length, dimension_multiply<Length, Length>>;
+using Density = dimension_divide<Mass, Volume>;
+using Pressure =
+    dimension_divide<dimension_multiply<Mass, Acceleration>,
+                     dimension_multiply<Length, Length>>;
+
+/// The name of the unit with Dimension D and Ratio R, for python_repr.
+/// Specialised for each named unit, e.g. Metres.
+template <typename D, typename R>
+constexpr const char *unit_name{"Quantity"};
+
+/// The symbol of the unit with Dimension D and Ratio R, for formatting.
+/// Specialised for each named unit, e.g. "m" for Metres.
+template <typename D, typename R>
+constexpr const char *unit_symbol{""};
+
+/// The maximum number of characters written by `to_chars`: the shortest
+/// representation of a double, a space and a unit symbol.
+constexpr std::size_t TO_CHARS_MAX_SIZE{32};
+
+/// The value types of a Quantity: floating point types, or signed integer
+/// types for compact storage in whole multiples of the unit.
+template <typename T>
+concept Representation = std::floating_point<T> || std::signed_integral<T>;
+
+/// A quantity of dimension D in units of Ratio R times the SI unit.
+template <typename D, typename R, typename T>
+  requires Representation<T>
+class Quantity final {
+#ifdef PYBIND11_NUMPY_DTYPE
+public:
+#endif
+  T v_;
+#ifndef PYBIND11_NUMPY_DTYPE
+public:
+#endif
+  using dimension = D;
+  using ratio = typename R::type;
+  using value_type = T;
+
+  /// The SI unit of the same dimension.
+  using si_unit = Quantity<D, std::ratio<1>, T>;
+
+  /// The type of the scale factors of the unit: the value type, or double
+  /// for integer value types.
+  using factor_type = std::conditional_t<std::floating_point<T>, T, double>;
+
+  /// The scale factor from this unit to the SI unit.
+  static constexpr factor_type si_factor{
+      static_cast<factor_type>(static_cast<long double>(ratio::num) /
+                               static_cast<long double>(ratio::den))};
+
+  /// Constructor
+  constexpr explicit Quantity(const T value) noexcept : v_{value} {}
+
+  /// Default constructor
+  constexpr Quantity() noexcept = default;
+
+  /// Constructor from the SI unit of the same dimension.
+  template <typename SiRatio>
+    requires std::ratio_equal_v<SiRatio, std::ratio<1>> &&
+             (!std::ratio_equal_v<R, std::ratio<1>>) && std::floating_point<T>
+  constexpr explicit Quantity(const Quantity<D, SiRatio, T> value) noexcept
+      : v_{value.v() / si_factor} {}
+
+  /// Convert to the SI unit of the same dimension.
+  [[nodiscard("Pure Function")]]
+  constexpr auto to_si() const noexcept -> si_unit
+    requires std::floating_point<T>
+  {
+    if constexpr (std::ratio_equal_v<ratio, std::ratio<1>>)
+      return si_unit(v_);
+    else
+      return si_unit(si_factor * v_);
+  }
+
+  /// Convert to Metres
+  [[nodiscard("Pure Function")]]
+  constexpr auto to_metres() const noexcept -> si_unit
+    requires std::same_as<D, Length> && std::floating_point<T>
+  {
+    return to_si();
+  }
+
+  /// Convert to MetresPerSecond
+  [[nodiscard("Pure Function")]]
+  constexpr auto to_metres_per_second() const noexcept -> si_unit
+    requires std::same_as<D, Speed> && std::floating_point<T>
+  {
+    return to_si();
+  }
+
+  /// The accessor for v.
+  [[nodiscard("Pure Function")]]
+  constexpr auto v() const noexcept -> T {
+    return v_;
+  }
+
+  /// The spaceship operator
+  constexpr std::partial_ordering operator<=>(const Quantity &other) const {
+    return v_ <=> other.v_;
+  }
+
+  /// The + operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator+(const Quantity &rhs) const noexcept -> Quantity {
+    return Quantity(v_ + rhs.v_);
+  }
+
+  /// The += operator
+  constexpr auto operator+=(const Quantity &rhs) noexcept -> Quantity & {
+    v_ += rhs.v_;
+    return *this;
+  }
+
+  /// Unary minus
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator-() const noexcept -> Quantity {
+    return Quantity(T() - v_);
+  }
+
+  /// The - operator
+  [[nodiscard("Pure Function")]]
+  constexpr auto operator-(const Quantity &rhs) const noexcept -> Quantity {
+    return Quantity(v_ - rhs.v_);
+  }
+
+  /// The -= operator
+  constexpr auto operator-=(const Quantity &rhs) noexcept -> Quantity & {
+    v_ -= rhs.v_;
+    return *this;
+  }
+
+  /// The *= operator, scaling by a value.
+  constexpr auto operator*=(const T rhs) noexcept -> Quantity & {
+    v_ *= rhs;
+    return *this;
+  }
+
+  /// The /= operator, scaling by a value.
+  constexpr auto operator/=(const T rhs) noexcept -> Quantity & {
+    v_ /= rhs;
+    return *this;
+  }
+
+  /// A Python representation of a Quantity.
+  /// I.e.: Name(v), e.g.: Metres(v), where v is the shortest representation
+  /// of the value that round trips.
+  /// @return a string in Python repr format.
+  std::string python_repr() const {
+    std::array<char, TO_CHARS_MAX_SIZE> value;
+    const auto result{
+        to_chars(value.data(), value.data() + value.size(), *this)};
+    std::string repr(unit_name<D, ratio>);
+    repr += '(';
+    repr.append(value.data(),
+                static_cast<std::size_t>(result.ptr - value.data()));
+    repr += ')';
+    return repr;
+  }
+}; // Quantity
+
+/// Whether U is a Quantity, e.g. Metres<double> or Feet<std::int32_t>.
+template <typename U> struct is_unit : std::false_type {};
+
+template <typename D, typename R, typename T>
+struct is_unit<Quantity<D, R, T>> : std::true_type {};
+
+template <typename U> constexpr bool is_unit_v{is_unit<U>::value};
+
+/// A unit: a Quantity with the size, alignment and layout of its value.
+/// So a span of units may be accessed as a span of their values, copied with
+/// memcpy and processed by the SIMD kernels, whatever the unit.
+template <typename U>
+concept Unit = is_unit_v<std::remove_cv_t<U>> &&
+               std::is_trivially_copyable_v<U> &&
+               std::is_standard_layout_v<U> &&
+               sizeof(U) == sizeof(typename U::value_type) &&
+               alignof(U) == alignof(typename U::value_type);
+
+/// The properties of a unit U, for generic algorithms.
+template <Unit U> struct unit_traits {
+  /// The type of the value of the unit.
+  using value_type = typename U::value_type;
+  /// The exponents of the dimension of the unit.
+  using dimension = typename U::dimension;
+  /// The ratio of the unit to the SI unit.
+  using ratio = typename U::ratio;
+  /// The SI unit of the same dimension.
+  using si_unit = typename U::si_unit;
+
+  /// The scale factor from the unit to the SI unit.
+  static constexpr auto si_factor{U::si_factor};
+
+  /// Whether the unit is the SI unit.
+  static constexpr bool is_si{std::ratio_equal_v<ratio, std::ratio<1>>};
+
+  /// The arithmetic operators of the unit: units of the same type may be
+  /// compared, added, subtracted and negated.
+  static constexpr bool has_addition{requires(U a, U b) {
+    { a + b } -> std::same_as<U>;
+    { a - b } -> std::same_as<U>;
+    { -a } -> std::same_as<U>;
+  }};
+  /// Whether the unit may be multiplied and divided by a value.
+  static constexpr bool has_scaling{requires(U a, value_type v) {
+    { a * v } -> std::same_as<U>;
+    { v * a } -> std::same_as<U>;
+    { a / v } -> std::same_as<U>;
+  }};
+  /// Whether the unit may be multiplied and divided by other units,
+  /// producing units of the product or quotient of their dimensions.
+  static constexpr bool has_product{requires(U a, si_unit b) {
+    a *b;
+    a / b;
+  }};
+  /// Whether the unit may be converted to the SI unit with `to_si`:
+  /// floating point units.
+  static constexpr bool has_to_si{requires(U a) {
+    { a.to_si() } -> std::same_as<si_unit>;
+  }};
+};
+
+/// The type of the value of a unit.
+template <Unit U> using unit_value_t = typename unit_traits<U>::value_type;
+
+/// The dimension of a unit.
+template <Unit U> using unit_dimension_t = typename unit_traits<U>::dimension;
+
+/// The SI unit of the dimension of a unit.
+template <Unit U> using unit_si_t = typename unit_traits<U>::si_unit;
+
+/// The scale factor from a unit to the SI unit.
+template <Unit U> constexpr auto unit_si_factor_v{unit_traits<U>::si_factor};
+
+namespace detail {
+/// Whether the unit template, e.g. Metres, is a Unit for every
+/// Representation.
+template <template <typename> typename U>
+constexpr bool is_unit_template{
+    Unit<U<float>> && Unit<U<double>> && Unit<U<long double>> &&
+    Unit<U<signed char>> && Unit<U<short>> && Unit<U<int>> &&
+    Unit<U<long>> && Unit<U<long long>>};
+} // namespace detail
+
+/// The factor to convert a value in unit From to unit To.
+/// The ratio between the units is calculated exactly, then converted to
+/// long double and rounded to the value type once, at compile time.
+/// So converting between any two units is a single multiplication, e.g.
+/// Feet to NauticalMiles, instead of a multiply and a divide via Metres.
+template <typename To, typename From>
+  requires std::same_as<typename To::dimension, typename From::dimension> &&
+           std::same_as<typename To::value_type, typename From::value_type> &&
+           std::floating_point<typename To::value_type>
+constexpr typename To::value_type conversion_factor{
+    static_cast<typename To::value_type>(
+        static_cast<long double>(
+            std::ratio_divide<typename From::ratio, typename To::ratio>::num) /
+        static_cast<long double>(
+            std::ratio_divide<typename From::ratio, typename To::ratio>::den))};
+
+/// Convert a Quantity to another unit of the same dimension, with a single
+/// multiplication by `conversion_factor`.
+/// Note: conversions to SI units are identical to `to_si`, but conversions
+/// from SI units multiply by the reciprocal of `si_factor` instead of
+/// dividing by it, so they may differ from the constructor by 1 ulp.
+/// @param from the Quantity to convert.
+/// @return the Quantity in units of To.
+template <typename To, typename D, typename R, typename T>
+  requires std::same_as<typename To::dimension, D> &&
+           std::same_as<typename To::value_type, T> && std::floating_point<T>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const Quantity<D, R, T> from) noexcept -> To {
+  if constexpr (std::same_as<To, Quantity<D, R, T>>)
+    return from;
+  else
+    return To(conversion_factor<To, Quantity<D, R, T>> * from.v());
+}
+
+/// Widen a Quantity with an integer value to a floating point unit of the
+/// same dimension, e.g. FlightLevels<std::int16_t> to Metres<double>.
+/// The value is converted to the floating point type and then multiplied by
+/// `conversion_factor`, unless the units are the same.
+/// @param from the integer Quantity to convert.
+/// @return the Quantity in units of To.
+template <typename To, typename D, typename R, typename I>
+  requires std::same_as<typename To::dimension, D> && std::signed_integral<I> &&
+           std::floating_point<typename To::value_type>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const Quantity<D, R, I> from) noexcept -> To {
+  using T = typename To::value_type;
+  const auto value{static_cast<T>(from.v())};
+  if constexpr (std::ratio_equal_v<R, typename To::ratio>)
+    return To(value);
+  else
+    return To(conversion_factor<To, Quantity<D, R, T>> * value);
+}
+
+/// Narrow a floating point Quantity to a unit with an integer value of the
+/// same dimension, rounding to the nearest whole unit, e.g. Metres<double>
+/// to Feet<std::int32_t>.
+/// @pre the rounded value is representable in the integer type.
+/// @param from the floating point Quantity to convert.
+/// @return the Quantity in units of To.
+template <typename To, typename D, typename R, typename T>
+  requires std::same_as<typename To::dimension, D> &&
+           std::floating_point<T> &&
+           std::signed_integral<typename To::value_type>
+[[nodiscard("Pure Function")]]
+constexpr auto convert(const Quantity<D, R, T> from) noexcept -> To {
+  using I = typename To::value_type;
+  const auto value{convert<Quantity<D, typename To::ratio, T>>(from).v()};
+  return To(static_cast<I>(std::round(value)));
+}
+
+/// Quantity equality operator
+template <typename D, typename R, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator==(const Quantity<D, R, T> &lhs,
+                          const Quantity<D, R, T> &rhs) noexcept -> bool {
+  return lhs.v() == rhs.v();
+}
+
+/// Quantity ostream << operator
+template <typename D, typename R, typename T>
+constexpr auto operator<<(std::ostream &os, const Quantity<D, R, T> &a)
+    -> std::ostream & {
+  return os << a.v();
+}
+
+/// Write a Quantity to a character buffer, without allocating memory.
+/// The value is written in the shortest representation that round trips,
+/// independent of the locale, optionally followed by a space and the unit
+/// symbol, e.g.: "1852 m".
+/// @param first, last the character buffer.
+/// @param a the Quantity.
+/// @param with_symbol whether to write the unit symbol.
+/// @return the end of the characters written and std::errc() or
+/// std::errc::value_too_large, as `std::to_chars`.
+template <typename D, typename R, typename T>
+auto to_chars(char *first, char *last, const Quantity<D, R, T> &a,
+              const bool with_symbol = false) noexcept -> std::to_chars_result {
+  auto result{std::to_chars(first, last, a.v())};
+  const std::string_view symbol{unit_symbol<D, typename R::type>};
+  if (result.ec != std::errc() || !with_symbol || symbol.empty())
+    return result;
+
+  if (last - result.ptr < static_cast<std::ptrdiff_t>(symbol.size() + 1))
+    return {last, std::errc::value_too_large};
+  *result.ptr++ = ' ';
+  result.ptr = std::ranges::copy(symbol, result.ptr).out;
+  return result;
+}
+
+/// Multiply a Quantity by a value.
+template <typename D, typename R, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator*(const Quantity<D, R, T> &lhs, const T rhs) noexcept
+    -> Quantity<D, R, T> {
+  return Quantity<D, R, T>(lhs.v() * rhs);
+}
+
+/// Multiply a value by a Quantity.
+template <typename D, typename R, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator*(const T lhs, const Quantity<D, R, T> &rhs) noexcept
+    -> Quantity<D, R, T> {
+  return Quantity<D, R, T>(lhs * rhs.v());
+}
+
+/// Divide a Quantity by a value.
+template <typename D, typename R, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator/(const Quantity<D, R, T> &lhs, const T rhs) noexcept
+    -> Quantity<D, R, T> {
+  return Quantity<D, R, T>(lhs.v() / rhs);
+}
+
+/// Multiply two Quantities.
+/// @return a Quantity with the product of their dimensions and ratios, or a
+/// value if the product is dimensionless in SI units.
+template <typename D1, typename R1, typename D2, typename R2, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator*(const Quantity<D1, R1, T> &lhs,
+                         const Quantity<D2, R2, T> &rhs) noexcept {
+  using D = dimension_multiply<D1, D2>;
+  using R = std::ratio_multiply<R1, R2>;
+  if constexpr (std::same_as<D, Dimensionless> &&
+                std::ratio_equal_v<R, std::ratio<1>>)
+    return lhs.v() * rhs.v();
+  else
+    return Quantity<D, R, T>(lhs.v() * rhs.v());
+}
+
+/// Divide two Quantities.
+/// @return a Quantity with the quotient of their dimensions and ratios, or a
+/// value if the quotient is dimensionless in SI units.
+template <typename D1, typename R1, typename D2, typename R2, typename T>
+[[nodiscard("Pure Function")]]
+constexpr auto operator/(const Quantity<D1, R1, T> &lhs,
+                         const Quantity<D2, R2, T> &rhs) noexcept {
+  using D = dimension_divide<D1, D2>;
+  using R = std::ratio_divide<R1, R2>;
+  if constexpr (std::same_as<D, Dimensionless> &&
+                std::ratio_equal_v<R, std::ratio<1>>)
+    return lhs.v() / rhs.v();
+  else
+    return Quantity<D, R, T>(lhs.v() / rhs.v());
+}
+
+} // namespace units
+} // namespace via
+
+#ifdef __cpp_lib_format
+namespace std {
+/// Format a Quantity with the floating point format specification of its
+/// value, e.g. "{:.1f}", where the default is the shortest representation
+/// that round trips.
+/// A 'u' at the start of the specification appends a space and the unit
+/// symbol, e.g.: std::format("{:u}", Metres<double>(1852)) is "1852 m".
+template <typename D, typename R, typename T>
+struct formatter<via::units::Quantity<D, R, T>, char> : formatter<T, char> {
+  bool with_symbol{false};
+
+  constexpr auto parse(std::format_parse_context &ctx) {
+    auto it{ctx.begin()};
+    if (it != ctx.end() && *it == 'u') {
+      with_symbol = true;
+      ctx.advance_to(++it);
+    }
+    return formatter<T, char>::parse(ctx);
+  }
+
+  template <typename FormatContext>
+  auto format(const via::units::Quantity<D, R, T> &a, FormatContext &ctx) const {
+    auto out{formatter<T, char>::format(a.v(), ctx)};
+    const std::string_view symbol{
+        via::units::unit_symbol<D, typename R::type>};
+    if (with_symbol && !symbol.empty()) {
+      *out++ = ' ';
+      out = std::ranges::copy(symbol, out).out;
+    }
+    return out;
+  }
+};
+} // namespace std
+#endif
@@ -24,510 +24,92 @@
 /// @file
 /// @brief SI units.
 //////////////////////////////////////////////////////////////////////////////
-#include <concepts>
-#include <ostream>
-#include <string>
+#include "quantity.hpp"
 
 namespace via {
 namespace units {
-namespace si {
-
-/// The Metres type for representing distance.
-template <typename T>
-  requires std::floating_point<T>
-class Metres final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Metres(const T value) noexcept : v_{value} {}
-
-  /// Default constructor
-  constexpr Metres() noexcept = default;
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Metres<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// The + operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator+(const Metres<T> &rhs) const noexcept -> Metres<T> {
-    return Metres<T>(v_ + rhs.v_);
-  }
-
-  /// The += operator
-  constexpr auto operator+=(const Metres<T> &rhs) noexcept -> Metres<T> & {
-    v_ += rhs.v_;
-    return *this;
-  }
-
-  /// Unary minus
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-() const noexcept -> Metres<T> {
-    return Metres(T() - v_);
-  }
 
-  /// The - operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-(const Metres<T> &rhs) const noexcept -> Metres<T> {
-    return Metres<T>(v_ - rhs.v_);
-  }
+template <>
+constexpr const char *unit_name<Length, std::ratio<1>>{"Metres"};
+template <>
+constexpr const char *unit_name<Time, std::ratio<1>>{"Seconds"};
+template <>
+constexpr const char *unit_name<Speed, std::ratio<1>>{"MetresPerSecond"};
+template <>
+constexpr const char *unit_name<Acceleration, std::ratio<1>>{
+    "MetresPerSecondSquared"};
+template <>
+constexpr const char *unit_name<Temperature, std::ratio<1>>{"Kelvin"};
+template <>
+constexpr const char *unit_name<Pressure, std::ratio<1>>{"Pascals"};
+template <>
+constexpr const char *unit_name<Mass, std::ratio<1>>{"Kilograms"};
+template <>
+constexpr const char *unit_name<Density, std::ratio<1>>{
+    "KilogramsPerCubicMetre"};
+
+template <> constexpr const char *unit_symbol<Length, std::ratio<1>>{"m"};
+template <> constexpr const char *unit_symbol<Time, std::ratio<1>>{"s"};
+template <> constexpr const char *unit_symbol<Speed, std::ratio<1>>{"m/s"};
+template <>
+constexpr const char *unit_symbol<Acceleration, std::ratio<1>>{"m/s^2"};
+template <> constexpr const char *unit_symbol<Temperature, std::ratio<1>>{"K"};
+template <> constexpr const char *unit_symbol<Pressure, std::ratio<1>>{"Pa"};
+template <> constexpr const char *unit_symbol<Mass, std::ratio<1>>{"kg"};
+template <>
+constexpr const char *unit_symbol<Density, std::ratio<1>>{"kg/m^3"};
 
-  /// The -= operator
-  constexpr auto operator-=(const Metres<T> &rhs) noexcept -> Metres<T> & {
-    v_ -= rhs.v_;
-    return *this;
-  }
-
-  /// A Python representation of a Metres.
-  /// I.e.: Metres(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "Metres(" + std::to_string(v_) + ")";
-  }
-}; // Metres
+namespace si {
 
-/// Metres equality operator
+/// The Metres type for representing distance.
 template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Metres<T> &lhs, const Metres<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
+  requires Representation<T>
+using Metres = Quantity<Length, std::ratio<1>, T>;
 
-/// Metres ostream << operator
+/// The Seconds type for representing time.
 template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Metres<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using Seconds = Quantity<Time, std::ratio<1>, T>;
 
 /// The MetresPerSecond type for representing speed.
 template <typename T>
-  requires std::floating_point<T>
-class MetresPerSecond final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit MetresPerSecond(const T value) noexcept : v_{value} {}
-
-  /// Default constructor
-  constexpr MetresPerSecond() noexcept = default;
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering
-  operator<=>(const MetresPerSecond<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// The + operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator+(const MetresPerSecond<T> &rhs) const noexcept
-      -> MetresPerSecond<T> {
-    return MetresPerSecond<T>(v_ + rhs.v_);
-  }
-
-  /// The += operator
-  constexpr auto operator+=(const MetresPerSecond<T> &rhs) noexcept
-      -> MetresPerSecond<T> & {
-    v_ += rhs.v_;
-    return *this;
-  }
-
-  /// Unary minus
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-() const noexcept -> MetresPerSecond<T> {
-    return MetresPerSecond(T() - v_);
-  }
-
-  /// The - operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-(const MetresPerSecond<T> &rhs) const noexcept
-      -> MetresPerSecond<T> {
-    return MetresPerSecond<T>(v_ - rhs.v_);
-  }
-
-  /// The -= operator
-  constexpr auto operator-=(const MetresPerSecond<T> &rhs) noexcept
-      -> MetresPerSecond<T> & {
-    v_ -= rhs.v_;
-    return *this;
-  }
-
-  /// A Python representation of a MetresPerSecond.
-  /// I.e.: MetresPerSecond(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "MetresPerSecond(" + std::to_string(v_) + ")";
-  }
-}; // MetresPerSecond
-
-/// MetresPerSecond equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const MetresPerSecond<T> &lhs,
-                          const MetresPerSecond<T> &rhs) noexcept -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// MetresPerSecond ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const MetresPerSecond<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using MetresPerSecond = Quantity<Speed, std::ratio<1>, T>;
 
 /// The MetresPerSecondSquared type for representing acceleration.
 template <typename T>
-  requires std::floating_point<T>
-class MetresPerSecondSquared final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit MetresPerSecondSquared(const T value) noexcept
-      : v_{value} {}
-
-  /// Default constructor
-  constexpr MetresPerSecondSquared() noexcept = default;
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering
-  operator<=>(const MetresPerSecondSquared<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a MetresPerSecondSquared.
-  /// I.e.: MetresPerSecondSquared(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "MetresPerSecondSquared(" + std::to_string(v_) + ")";
-  }
-}; // MetresPerSecondSquared
-
-/// MetresPerSecondSquared equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const MetresPerSecondSquared<T> &lhs,
-                          const MetresPerSecondSquared<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// MetresPerSecondSquared ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const MetresPerSecondSquared<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using MetresPerSecondSquared = Quantity<Acceleration, std::ratio<1>, T>;
 
 /// The Kelvin type for representing temperature.
 template <typename T>
-  requires std::floating_point<T>
-class Kelvin final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Kelvin(const T value) noexcept : v_{value} {}
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Kelvin<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// The + operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator+(const Kelvin<T> &rhs) const noexcept -> Kelvin<T> {
-    return Kelvin<T>(v_ + rhs.v_);
-  }
-
-  /// The += operator
-  constexpr auto operator+=(const Kelvin<T> &rhs) noexcept -> Kelvin<T> & {
-    v_ += rhs.v_;
-    return *this;
-  }
-
-  /// Unary minus
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-() const noexcept -> Kelvin<T> {
-    return Kelvin(T() - v_);
-  }
-
-  /// The - operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-(const Kelvin<T> &rhs) const noexcept -> Kelvin<T> {
-    return Kelvin<T>(v_ - rhs.v_);
-  }
-
-  /// The -= operator
-  constexpr auto operator-=(const Kelvin<T> &rhs) noexcept -> Kelvin<T> & {
-    v_ -= rhs.v_;
-    return *this;
-  }
-
-  /// A Python representation of a Kelvin.
-  /// I.e.: Kelvin(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "Kelvin(" + std::to_string(v_) + ")";
-  }
-}; // Kelvin
-
-/// Kelvin equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Kelvin<T> &lhs, const Kelvin<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// Kelvin ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Kelvin<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using Kelvin = Quantity<Temperature, std::ratio<1>, T>;
 
 /// The Pascals type for representing pressure.
 template <typename T>
-  requires std::floating_point<T>
-class Pascals final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Pascals(const T value) noexcept : v_{value} {}
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Pascals<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a Pascals.
-  /// I.e.: Pascals(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "Pascals(" + std::to_string(v_) + ")";
-  }
-}; // Pascals
-
-/// Pascals equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Pascals<T> &lhs, const Pascals<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// Pascals ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Pascals<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using Pascals = Quantity<Pressure, std::ratio<1>, T>;
 
 /// The Kilograms type for representing mass.
 template <typename T>
-  requires std::floating_point<T>
-class Kilograms final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit Kilograms(const T value) noexcept : v_{value} {}
-
-  /// Default constructor
-  constexpr Kilograms() noexcept = default;
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering operator<=>(const Kilograms<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// The + operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator+(const Kilograms<T> &rhs) const noexcept
-      -> Kilograms<T> {
-    return Kilograms<T>(v_ + rhs.v_);
-  }
-
-  /// The += operator
-  constexpr auto operator+=(const Kilograms<T> &rhs) noexcept
-      -> Kilograms<T> & {
-    v_ += rhs.v_;
-    return *this;
-  }
-
-  /// Unary minus
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-() const noexcept -> Kilograms<T> {
-    return Kilograms(T() - v_);
-  }
-
-  /// The - operator
-  [[nodiscard("Pure Function")]]
-  constexpr auto operator-(const Kilograms<T> &rhs) const noexcept
-      -> Kilograms<T> {
-    return Kilograms<T>(v_ - rhs.v_);
-  }
-
-  /// The -= operator
-  constexpr auto operator-=(const Kilograms<T> &rhs) noexcept
-      -> Kilograms<T> & {
-    v_ -= rhs.v_;
-    return *this;
-  }
-
-  /// A Python representation of a Kilograms.
-  /// I.e.: Kilograms(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "Kilograms(" + std::to_string(v_) + ")";
-  }
-}; // Kilograms
-
-/// Kilograms equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const Kilograms<T> &lhs,
-                          const Kilograms<T> &rhs) noexcept -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// Kilograms ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const Kilograms<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using Kilograms = Quantity<Mass, std::ratio<1>, T>;
 
 /// The KilogramsPerCubicMetre type for representing density.
 template <typename T>
-  requires std::floating_point<T>
-class KilogramsPerCubicMetre final {
-#ifdef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  T v_;
-#ifndef PYBIND11_NUMPY_DTYPE
-public:
-#endif
-  /// Constructor
-  constexpr explicit KilogramsPerCubicMetre(const T value) noexcept
-      : v_{value} {}
-
-  /// The accessor for v.
-  [[nodiscard("Pure Function")]]
-  constexpr auto v() const noexcept -> T {
-    return v_;
-  }
-
-  /// The spaceship operator
-  constexpr std::partial_ordering
-  operator<=>(const KilogramsPerCubicMetre<T> &other) const {
-    return v_ <=> other.v_;
-  }
-
-  /// A Python representation of a KilogramsPerCubicMetre.
-  /// I.e.: KilogramsPerCubicMetre(v)
-  /// @return a string in Python repr format.
-  std::string python_repr() const {
-    return "KilogramsPerCubicMetre(" + std::to_string(v_) + ")";
-  }
-}; // KilogramsPerCubicMetre
-
-/// KilogramsPerCubicMetre equality operator
-template <typename T>
-  requires std::floating_point<T>
-[[nodiscard("Pure Function")]]
-constexpr auto operator==(const KilogramsPerCubicMetre<T> &lhs,
-                          const KilogramsPerCubicMetre<T> &rhs) noexcept
-    -> bool {
-  return lhs.v() == rhs.v();
-}
-
-/// KilogramsPerCubicMetre ostream << operator
-template <typename T>
-  requires std::floating_point<T>
-constexpr auto operator<<(std::ostream &os, const KilogramsPerCubicMetre<T> &a)
-    -> std::ostream & {
-  return os << a.v();
-}
+  requires Representation<T>
+using KilogramsPerCubicMetre = Quantity<Density, std::ratio<1>, T>;
+
+// Every SI unit has the size, alignment and layout of its value.
+static_assert(detail::is_unit_template<Metres> &&
+              detail::is_unit_template<Seconds> &&
+              detail::is_unit_template<MetresPerSecond> &&
+              detail::is_unit_template<MetresPerSecondSquared> &&
+              detail::is_unit_template<Kelvin> &&
+              detail::is_unit_template<Pascals> &&
+              detail::is_unit_template<Kilograms> &&
+              detail::is_unit_template<KilogramsPerCubicMetre>);
 
 } // namespace si
 } // namespace units
@@ -0,0 +1,590 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Explicit SIMD kernels for contiguous arrays of floating point values.
+///
+/// The instruction set is selected at compile time: AVX-512, AVX or SSE2 on
+/// x86, otherwise a scalar loop.
+/// The `widen` kernels load float, 16 or 32 bit integer values and convert
+/// them to a wider floating point type in the registers.
+/// Each kernel performs exactly the same IEEE 754 operation on every element
+/// as the equivalent scalar expression, so the results are bit-for-bit
+/// identical to the scalar path, except for the order of additions in `sum`.
+//////////////////////////////////////////////////////////////////////////////
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__) ||          \
+    defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+namespace via {
+namespace units {
+namespace simd {
+
+/// The types that the kernels widen to a floating point type: float to
+/// double, and 16 and 32 bit integers to float or double.
+template <typename S>
+concept Widenable = std::same_as<S, float> || std::same_as<S, std::int16_t> ||
+                    std::same_as<S, std::int32_t>;
+
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__) ||          \
+    defined(_M_X64)
+namespace detail {
+
+/// Sign extend the low four 16 bit integers of x to 32 bit integers.
+inline auto extend_low_epi16(const __m128i x) noexcept -> __m128i {
+  return _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+}
+
+/// Sign extend the high four 16 bit integers of x to 32 bit integers.
+inline auto extend_high_epi16(const __m128i x) noexcept -> __m128i {
+  return _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+}
+
+} // namespace detail
+#endif
+
+/// The operations on a single floating point value, with the interface of
+/// `Lanes`, for the scalar functions and the scalar tails of the kernels.
+/// They are constexpr, so that the scalar functions that evaluate the
+/// kernels are constexpr.
+template <typename T>
+  requires std::floating_point<T>
+struct Scalar {
+  using type = T;
+  static constexpr std::size_t size{1};
+
+  static constexpr auto load(const T *p) noexcept -> type { return *p; }
+  static constexpr void store(T *p, const type v) noexcept { *p = v; }
+  static constexpr auto broadcast(const T x) noexcept -> type { return x; }
+  static constexpr auto add(const type a, const type b) noexcept -> type {
+    return a + b;
+  }
+  static constexpr auto sub(const type a, const type b) noexcept -> type {
+    return a - b;
+  }
+  static constexpr auto mul(const type a, const type b) noexcept -> type {
+    return a * b;
+  }
+  static constexpr auto div(const type a, const type b) noexcept -> type {
+    return a / b;
+  }
+  /// std::sqrt at run time and Newton-Raphson iterations in constant
+  /// expressions.
+  /// @pre a >= 0
+  static constexpr auto sqrt(const type a) noexcept -> type {
+    if consteval {
+      if (a <= 0)
+        return T();
+      const auto x{static_cast<long double>(a)};
+      long double r{x < 1 ? 1 : x};
+      for (int i{0}; i < 100; ++i) {
+        const long double next{(r + x / r) / 2};
+        if (next >= r)
+          break;
+        r = next;
+      }
+      return static_cast<T>(r);
+    } else {
+      return std::sqrt(a);
+    }
+  }
+  /// Select x where a < b, otherwise y.
+  static constexpr auto select_less(const type a, const type b, const type x,
+                                    const type y) noexcept -> type {
+    return a < b ? x : y;
+  }
+  /// Whether a < b in any lane.
+  static constexpr auto any_less(const type a, const type b) noexcept
+      -> bool {
+    return a < b;
+  }
+};
+
+/// The SIMD registers for a floating point type.
+/// The primary template is the scalar fallback: a single lane.
+template <typename T>
+  requires std::floating_point<T>
+struct Lanes : Scalar<T> {
+  using typename Scalar<T>::type;
+
+  template <Widenable S> static auto widen(const S *p) noexcept -> type {
+    return static_cast<T>(*p);
+  }
+};
+
+#if defined(__AVX512F__)
+/// The AVX-512 registers for double.
+template <> struct Lanes<double> {
+  using type = __m512d;
+  static constexpr std::size_t size{8};
+
+  static auto load(const double *p) noexcept -> type {
+    return _mm512_loadu_pd(p);
+  }
+  static void store(double *p, const type v) noexcept {
+    _mm512_storeu_pd(p, v);
+  }
+  static auto broadcast(const double x) noexcept -> type {
+    return _mm512_set1_pd(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm512_add_pd(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm512_sub_pd(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm512_mul_pd(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm512_div_pd(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    // Note: _mm512_sqrt_pd causes a false -Wmaybe-uninitialized in gcc 12
+    return _mm512_maskz_sqrt_pd(0xFF, a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), y, x);
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ) != 0;
+  }
+  static auto widen(const float *p) noexcept -> type {
+    // Note: _mm512_cvtps_pd causes a false -Wmaybe-uninitialized in gcc 12
+    return _mm512_maskz_cvtps_pd(0xFF, _mm256_loadu_ps(p));
+  }
+  // Note: _mm512_cvtepi32_pd causes a false -Wmaybe-uninitialized in gcc 12
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    return _mm512_maskz_cvtepi32_pd(
+        0xFF, _mm256_cvtepi16_epi32(
+                  _mm_loadu_si128(reinterpret_cast<const __m128i *>(p))));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm512_maskz_cvtepi32_pd(
+        0xFF, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)));
+  }
+};
+
+/// The AVX-512 registers for float.
+template <> struct Lanes<float> {
+  using type = __m512;
+  static constexpr std::size_t size{16};
+
+  static auto load(const float *p) noexcept -> type {
+    return _mm512_loadu_ps(p);
+  }
+  static void store(float *p, const type v) noexcept {
+    _mm512_storeu_ps(p, v);
+  }
+  static auto broadcast(const float x) noexcept -> type {
+    return _mm512_set1_ps(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm512_add_ps(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm512_sub_ps(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm512_mul_ps(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm512_div_ps(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    // Note: _mm512_sqrt_ps causes a false -Wmaybe-uninitialized in gcc 12
+    return _mm512_maskz_sqrt_ps(0xFFFF, a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ) != 0;
+  }
+  // Note: _mm512_cvtepi32_ps and _mm512_cvtepi16_epi32 cause a false
+  // -Wmaybe-uninitialized in gcc 12
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    return _mm512_maskz_cvtepi32_ps(
+        0xFFFF, _mm512_maskz_cvtepi16_epi32(
+                    0xFFFF, _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(p))));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_loadu_si512(p));
+  }
+};
+#elif defined(__AVX__)
+/// The AVX registers for double.
+template <> struct Lanes<double> {
+  using type = __m256d;
+  static constexpr std::size_t size{4};
+
+  static auto load(const double *p) noexcept -> type {
+    return _mm256_loadu_pd(p);
+  }
+  static void store(double *p, const type v) noexcept {
+    _mm256_storeu_pd(p, v);
+  }
+  static auto broadcast(const double x) noexcept -> type {
+    return _mm256_set1_pd(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm256_add_pd(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm256_sub_pd(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm256_mul_pd(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm256_div_pd(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    return _mm256_sqrt_pd(a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_LT_OQ));
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)) != 0;
+  }
+  static auto widen(const float *p) noexcept -> type {
+    return _mm256_cvtps_pd(_mm_loadu_ps(p));
+  }
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    return _mm256_cvtepi32_pd(detail::extend_low_epi16(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm256_cvtepi32_pd(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+  }
+};
+
+/// The AVX registers for float.
+template <> struct Lanes<float> {
+  using type = __m256;
+  static constexpr std::size_t size{8};
+
+  static auto load(const float *p) noexcept -> type {
+    return _mm256_loadu_ps(p);
+  }
+  static void store(float *p, const type v) noexcept {
+    _mm256_storeu_ps(p, v);
+  }
+  static auto broadcast(const float x) noexcept -> type {
+    return _mm256_set1_ps(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm256_add_ps(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm256_sub_ps(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm256_mul_ps(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm256_div_ps(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    return _mm256_sqrt_ps(a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)) != 0;
+  }
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    const auto x{_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))};
+    return _mm256_cvtepi32_ps(_mm256_set_m128i(detail::extend_high_epi16(x),
+                                               detail::extend_low_epi16(x)));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm256_cvtepi32_ps(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)));
+  }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+/// The SSE2 registers for double.
+template <> struct Lanes<double> {
+  using type = __m128d;
+  static constexpr std::size_t size{2};
+
+  static auto load(const double *p) noexcept -> type { return _mm_loadu_pd(p); }
+  static void store(double *p, const type v) noexcept { _mm_storeu_pd(p, v); }
+  static auto broadcast(const double x) noexcept -> type {
+    return _mm_set1_pd(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm_add_pd(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm_sub_pd(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm_mul_pd(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm_div_pd(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    return _mm_sqrt_pd(a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    const auto less{_mm_cmplt_pd(a, b)};
+    return _mm_or_pd(_mm_and_pd(less, x), _mm_andnot_pd(less, y));
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm_movemask_pd(_mm_cmplt_pd(a, b)) != 0;
+  }
+  static auto widen(const float *p) noexcept -> type {
+    return _mm_cvtps_pd(
+        _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+  }
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    return _mm_cvtepi32_pd(detail::extend_low_epi16(_mm_loadu_si32(p)));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm_cvtepi32_pd(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)));
+  }
+};
+
+/// The SSE2 registers for float.
+template <> struct Lanes<float> {
+  using type = __m128;
+  static constexpr std::size_t size{4};
+
+  static auto load(const float *p) noexcept -> type { return _mm_loadu_ps(p); }
+  static void store(float *p, const type v) noexcept { _mm_storeu_ps(p, v); }
+  static auto broadcast(const float x) noexcept -> type {
+    return _mm_set1_ps(x);
+  }
+  static auto add(const type a, const type b) noexcept -> type {
+    return _mm_add_ps(a, b);
+  }
+  static auto sub(const type a, const type b) noexcept -> type {
+    return _mm_sub_ps(a, b);
+  }
+  static auto mul(const type a, const type b) noexcept -> type {
+    return _mm_mul_ps(a, b);
+  }
+  static auto div(const type a, const type b) noexcept -> type {
+    return _mm_div_ps(a, b);
+  }
+  static auto sqrt(const type a) noexcept -> type {
+    return _mm_sqrt_ps(a);
+  }
+  static auto select_less(const type a, const type b, const type x,
+                          const type y) noexcept -> type {
+    const auto less{_mm_cmplt_ps(a, b)};
+    return _mm_or_ps(_mm_and_ps(less, x), _mm_andnot_ps(less, y));
+  }
+  static auto any_less(const type a, const type b) noexcept -> bool {
+    return _mm_movemask_ps(_mm_cmplt_ps(a, b)) != 0;
+  }
+  static auto widen(const std::int16_t *p) noexcept -> type {
+    return _mm_cvtepi32_ps(detail::extend_low_epi16(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+  }
+  static auto widen(const std::int32_t *p) noexcept -> type {
+    return _mm_cvtepi32_ps(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+  }
+};
+#endif
+
+/// Multiply every value in `in` by `factor`, writing the results to `out`.
+/// `in` and `out` may be the same array.
+/// @pre out.size() >= in.size()
+/// @param in the values to multiply.
+/// @param factor the multiplication factor.
+/// @param out the results.
+template <typename T>
+  requires std::floating_point<T>
+void multiply(std::span<const T> in, const T factor,
+              std::span<T> out) noexcept {
+  using V = Lanes<T>;
+  const auto n{in.size()};
+  const T *src{in.data()};
+  T *dst{out.data()};
+
+  const auto f{V::broadcast(factor)};
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size)
+    V::store(dst + i, V::mul(V::load(src + i), f));
+  for (; i < n; ++i)
+    dst[i] = src[i] * factor;
+}
+
+/// Divide every value in `in` by `divisor`, writing the results to `out`.
+/// `in` and `out` may be the same array.
+/// @pre out.size() >= in.size()
+/// @param in the values to divide.
+/// @param divisor the divisor.
+/// @param out the results.
+template <typename T>
+  requires std::floating_point<T>
+void divide(std::span<const T> in, const T divisor, std::span<T> out) noexcept {
+  using V = Lanes<T>;
+  const auto n{in.size()};
+  const T *src{in.data()};
+  T *dst{out.data()};
+
+  const auto d{V::broadcast(divisor)};
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size)
+    V::store(dst + i, V::div(V::load(src + i), d));
+  for (; i < n; ++i)
+    dst[i] = src[i] / divisor;
+}
+
+/// Add the values in `a` and `b`, writing the results to `out`.
+/// `out` may be the same array as `a` or `b`.
+/// @pre a.size() == b.size() and out.size() >= a.size()
+/// @param a, b the values to add.
+/// @param out the results.
+template <typename T>
+  requires std::floating_point<T>
+void add(std::span<const T> a, std::span<const T> b,
+         std::span<T> out) noexcept {
+  using V = Lanes<T>;
+  const auto n{a.size()};
+  const T *lhs{a.data()};
+  const T *rhs{b.data()};
+  T *dst{out.data()};
+
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size)
+    V::store(dst + i, V::add(V::load(lhs + i), V::load(rhs + i)));
+  for (; i < n; ++i)
+    dst[i] = lhs[i] + rhs[i];
+}
+
+/// Subtract the values in `b` from the values in `a`, writing the results
+/// to `out`.
+/// `out` may be the same array as `a` or `b`.
+/// @pre a.size() == b.size() and out.size() >= a.size()
+/// @param a the values to subtract from.
+/// @param b the values to subtract.
+/// @param out the results.
+template <typename T>
+  requires std::floating_point<T>
+void subtract(std::span<const T> a, std::span<const T> b,
+              std::span<T> out) noexcept {
+  using V = Lanes<T>;
+  const auto n{a.size()};
+  const T *lhs{a.data()};
+  const T *rhs{b.data()};
+  T *dst{out.data()};
+
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size)
+    V::store(dst + i, V::sub(V::load(lhs + i), V::load(rhs + i)));
+  for (; i < n; ++i)
+    dst[i] = lhs[i] - rhs[i];
+}
+
+/// Multiply every value in `in` by a `factor` of a wider floating point
+/// type, writing the results to `out`, e.g. float values by a double
+/// factor, or 16 bit integer values by a float factor.
+/// The results are bit-for-bit identical to converting each value to the
+/// type of `factor` before multiplying it.
+/// @pre out.size() >= in.size()
+/// @param in the values to multiply.
+/// @param factor the multiplication factor.
+/// @param out the results.
+template <Widenable S, typename T>
+  requires std::floating_point<T> && (!std::same_as<S, T>)
+void widen_multiply(std::span<const S> in, const T factor,
+                    std::span<T> out) noexcept {
+  using V = Lanes<T>;
+  const auto n{in.size()};
+  const S *src{in.data()};
+  T *dst{out.data()};
+
+  const auto f{V::broadcast(factor)};
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size)
+    V::store(dst + i, V::mul(V::widen(src + i), f));
+  for (; i < n; ++i)
+    dst[i] = static_cast<T>(src[i]) * factor;
+}
+
+/// The sum of the values, accumulated in double.
+/// Note: the values are added in SIMD lanes, so the result may differ from
+/// adding them in order by rounding.
+/// @param in the values to add: double, float, 16 or 32 bit integers.
+/// @return the sum of the values.
+template <typename T>
+  requires std::same_as<T, double> || Widenable<T>
+[[nodiscard("Pure Function")]]
+auto sum(std::span<const T> in) noexcept -> double {
+  using V = Lanes<double>;
+  const auto n{in.size()};
+  const T *src{in.data()};
+
+  auto total{V::broadcast(0.0)};
+  const auto vector_n{n - n % V::size};
+  std::size_t i{0};
+  for (; i != vector_n; i += V::size) {
+    if constexpr (std::same_as<T, double>)
+      total = V::add(total, V::load(src + i));
+    else
+      total = V::add(total, V::widen(src + i));
+  }
+
+  std::array<double, V::size> lanes;
+  V::store(lanes.data(), total);
+  double result{0};
+  for (const auto lane : lanes)
+    result += lane;
+  for (; i < n; ++i)
+    result += static_cast<double>(src[i]);
+  return result;
+}
+
+} // namespace simd
+} // namespace units
+} // namespace via
@@ -0,0 +1,329 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////
+/// @file
+/// @brief Opt-in tracing of the batch functions.
+///
+/// When `VIA_UNITS_TRACE` is defined, each batch function counts its calls,
+/// the elements it processed, the time it took and the sizes of its batches,
+/// for each instantiation of the function, e.g. `convert` from `Feet<float>`
+/// to `Metres<double>`. `trace::snapshot` returns the counts.
+///
+/// The counts are kept in `thread_local` counters that are only written by
+/// their thread, so counting a call takes no locks or atomic read-modify-write
+/// instructions. A mutex is only locked the first time that a thread or a
+/// function instantiation is traced, when a thread exits and by `snapshot`.
+/// Note: a batch function with an execution policy counts a call for each
+/// chunk.
+///
+/// When `VIA_UNITS_TRACE` is not defined, `VIA_UNITS_TRACE_CALL` expands to
+/// nothing, so the batch functions are unchanged, and `snapshot` returns no
+/// records.
+///
+/// `VIA_UNITS_TRACE` must be defined the same way in every translation unit
+/// of a program, e.g. with the CMake option `CPP_TRACE`.
+//////////////////////////////////////////////////////////////////////////////
+#include "quantity.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#ifdef VIA_UNITS_TRACE
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+#endif
+
+namespace via {
+namespace units {
+namespace trace {
+
+/// Whether the batch functions are traced, i.e. `VIA_UNITS_TRACE` is defined.
+#ifdef VIA_UNITS_TRACE
+constexpr bool ENABLED{true};
+#else
+constexpr bool ENABLED{false};
+#endif
+
+/// The number of batch size buckets: sizes below 16, 256, 4096... elements,
+/// with the last bucket counting all larger batches.
+constexpr std::size_t BATCH_SIZE_BUCKETS{8};
+
+/// The maximum number of traced function instantiations, further
+/// instantiations are not traced.
+constexpr std::size_t MAX_SITES{256};
+
+/// The counts of the calls of a traced function instantiation.
+struct Record {
+  /// The name of the function, e.g. "convert".
+  std::string function;
+  /// The units of the function, e.g. "Feet<float> -> Metres<double>".
+  std::string units;
+  /// The number of calls.
+  std::uint64_t calls{0};
+  /// The number of elements processed by the calls.
+  std::uint64_t elements{0};
+  /// The time taken by the calls in nanoseconds.
+  std::uint64_t nanoseconds{0};
+  /// The number of calls in each batch size bucket: calls of fewer than
+  /// 16 elements, fewer than 256 elements, etc.
+  std::array<std::uint64_t, BATCH_SIZE_BUCKETS> batch_sizes{};
+};
+
+/// The name of a traced type, e.g. "Feet<float>".
+/// Specialised for types that are not units or arithmetic types.
+template <typename T> struct type_name {
+  static auto get() -> std::string {
+    if constexpr (Unit<T>)
+      return std::string(unit_name<typename T::dimension, typename T::ratio>) +
+             '<' + type_name<typename T::value_type>::get() + '>';
+    else if constexpr (std::same_as<T, float>)
+      return "float";
+    else if constexpr (std::same_as<T, double>)
+      return "double";
+    else if constexpr (std::signed_integral<T>)
+      return "int" + std::to_string(8 * sizeof(T)) + "_t";
+    else
+      return "?";
+  }
+};
+
+#ifdef VIA_UNITS_TRACE
+namespace detail {
+
+/// A traced function instantiation.
+struct Site {
+  std::string function;
+  std::string units;
+};
+
+/// The counters of a thread, for each site.
+/// Each counter is only written by its thread, so it is incremented with a
+/// relaxed load and store, and read by `snapshot` with a relaxed load.
+struct Counters {
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> elements{0};
+  std::atomic<std::uint64_t> nanoseconds{0};
+  std::array<std::atomic<std::uint64_t>, BATCH_SIZE_BUCKETS> batch_sizes{};
+};
+
+class ThreadCounters;
+
+/// The sites, the counters of the running threads and the counts of the
+/// threads that have exited.
+struct Registry {
+  std::mutex mutex;
+  std::vector<Site> sites;
+  std::vector<const ThreadCounters *> threads;
+  std::vector<Record> exited;
+  /// The counts at the last `reset`.
+  std::vector<Record> reset;
+};
+
+/// The registry. It is never destroyed, so that threads may exit during
+/// the destruction of static objects, e.g. a static ThreadPool.
+inline auto registry() -> Registry & {
+  static auto *const registry{new Registry};
+  return *registry;
+}
+
+/// Add the counts of a thread's counters to records.
+inline void add_counts(const std::array<Counters, MAX_SITES> &counters,
+                       std::vector<Record> &records) {
+  constexpr auto relaxed{std::memory_order_relaxed};
+  for (std::size_t i{0}; i < records.size(); ++i) {
+    auto &record{records[i]};
+    record.calls += counters[i].calls.load(relaxed);
+    record.elements += counters[i].elements.load(relaxed);
+    record.nanoseconds += counters[i].nanoseconds.load(relaxed);
+    for (std::size_t b{0}; b < BATCH_SIZE_BUCKETS; ++b)
+      record.batch_sizes[b] += counters[i].batch_sizes[b].load(relaxed);
+  }
+}
+
+/// The counters of the current thread, registered in the registry while the
+/// thread is running.
+class ThreadCounters final {
+  std::array<Counters, MAX_SITES> counters_;
+
+public:
+  ThreadCounters() {
+    auto &r{registry()};
+    const std::lock_guard lock{r.mutex};
+    r.threads.push_back(this);
+  }
+
+  ~ThreadCounters() {
+    auto &r{registry()};
+    const std::lock_guard lock{r.mutex};
+    std::erase(r.threads, this);
+    r.exited.resize(r.sites.size());
+    add_counts(counters_, r.exited);
+  }
+
+  ThreadCounters(const ThreadCounters &) = delete;
+  ThreadCounters &operator=(const ThreadCounters &) = delete;
+
+  [[nodiscard]] auto counters() const noexcept
+      -> const std::array<Counters, MAX_SITES> & {
+    return counters_;
+  }
+
+  /// Count a call of site with elements, that took nanoseconds.
+  void count(const std::size_t site, const std::uint64_t elements,
+             const std::uint64_t nanoseconds) noexcept {
+    constexpr auto relaxed{std::memory_order_relaxed};
+    const auto add{[](std::atomic<std::uint64_t> &counter,
+                      const std::uint64_t n) {
+      counter.store(counter.load(relaxed) + n, relaxed);
+    }};
+    auto &counters{counters_[site]};
+    add(counters.calls, 1);
+    add(counters.elements, elements);
+    add(counters.nanoseconds, nanoseconds);
+    const auto bucket{std::min<std::size_t>(
+        (std::bit_width(elements | 1) - 1) / 4, BATCH_SIZE_BUCKETS - 1)};
+    add(counters.batch_sizes[bucket], 1);
+  }
+
+  /// The counters of the current thread.
+  static auto instance() -> ThreadCounters & {
+    thread_local ThreadCounters counters;
+    return counters;
+  }
+};
+
+/// Register the site of function traced with types Ts.
+/// @return the index of the site, MAX_SITES if there are too many sites.
+template <typename... Ts>
+auto register_site(const char *function) -> std::size_t {
+  std::string units;
+  ((units += (units.empty() ? "" : " -> ") + type_name<Ts>::get()), ...);
+  auto &r{registry()};
+  const std::lock_guard lock{r.mutex};
+  if (r.sites.size() == MAX_SITES)
+    return MAX_SITES;
+  r.sites.push_back({function, std::move(units)});
+  return r.sites.size() - 1;
+}
+
+/// Count a call of a site from construction to destruction.
+class Scope final {
+  using Clock = std::chrono::steady_clock;
+
+  std::size_t site_;
+  std::uint64_t elements_;
+  Clock::time_point start_;
+
+public:
+  Scope(const std::size_t site, const std::uint64_t elements) noexcept
+      : site_{site}, elements_{elements}, start_{Clock::now()} {}
+
+  ~Scope() {
+    if (site_ < MAX_SITES)
+      ThreadCounters::instance().count(
+          site_, elements_,
+          static_cast<std::uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  Clock::now() - start_)
+                  .count()));
+  }
+
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+};
+
+/// The counts of every site since the program started.
+/// @pre the registry's mutex is locked.
+inline auto totals(Registry &r) -> std::vector<Record> {
+  std::vector<Record> records(r.sites.size());
+  for (std::size_t i{0}; i < r.exited.size(); ++i)
+    records[i] = r.exited[i];
+  for (const auto *thread : r.threads)
+    add_counts(thread->counters(), records);
+  return records;
+}
+
+} // namespace detail
+#endif
+
+/// The counts of the traced function instantiations that have been called
+/// since the program started or the last `reset`.
+/// @return the records, empty if tracing is not enabled.
+inline auto snapshot() -> std::vector<Record> {
+  std::vector<Record> records;
+#ifdef VIA_UNITS_TRACE
+  auto &r{detail::registry()};
+  const std::lock_guard lock{r.mutex};
+  const auto totals{detail::totals(r)};
+  for (std::size_t i{0}; i < totals.size(); ++i) {
+    auto record{totals[i]};
+    if (i < r.reset.size()) {
+      const auto &reset{r.reset[i]};
+      record.calls -= reset.calls;
+      record.elements -= reset.elements;
+      record.nanoseconds -= reset.nanoseconds;
+      for (std::size_t b{0}; b < BATCH_SIZE_BUCKETS; ++b)
+        record.batch_sizes[b] -= reset.batch_sizes[b];
+    }
+    if (record.calls) {
+      record.function = r.sites[i].function;
+      record.units = r.sites[i].units;
+      records.push_back(std::move(record));
+    }
+  }
+#endif
+  return records;
+}
+
+/// Reset the counts returned by `snapshot` to zero.
+inline void reset() {
+#ifdef VIA_UNITS_TRACE
+  auto &r{detail::registry()};
+  const std::lock_guard lock{r.mutex};
+  r.reset = detail::totals(r);
+#endif
+}
+
+} // namespace trace
+} // namespace units
+} // namespace via
+
+/// Trace a call of a batch function with name function, processing elements,
+/// e.g. `VIA_UNITS_TRACE_CALL("convert", in.size(), From, To);`.
+/// The function instantiation is named by the remaining arguments: the types
+/// of its units, e.g. From and To.
+/// Expands to nothing unless `VIA_UNITS_TRACE` is defined.
+#ifdef VIA_UNITS_TRACE
+#define VIA_UNITS_TRACE_CALL(function, elements, ...)                          \
+  static const std::size_t via_units_trace_site{                               \
+      ::via::units::trace::detail::register_site<__VA_ARGS__>(function)};      \
+  const ::via::units::trace::detail::Scope via_units_trace_scope{              \
+      via_units_trace_site, static_cast<std::uint64_t>(elements)}
+#else
+#define VIA_UNITS_TRACE_CALL(function, elements, ...)
+#endif
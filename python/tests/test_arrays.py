@@ -0,0 +1,350 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Ken Barker
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+#  @file test_arrays
+#  @brief Contains unit tests for the via units numpy array functions.
+
+import numpy as np
+import pytest
+from via_units import Feet, Knots, Metres, MetresPerSecond, NauticalMiles, \
+    Feet32, Metres32, NauticalMiles32, MetresArray, Metres32Array, FeetArray, \
+    METRES_PER_FOOT, METRES_PER_NAUTICAL_MILE, METRES_PER_SECOND_TO_KNOTS, \
+    feet_to_metres, metres_to_feet, \
+    nautical_miles_to_metres, metres_to_nautical_miles, \
+    knots_to_metres_per_second, metres_per_second_to_knots, astype, \
+    TRACE_ENABLED, trace_reset, trace_snapshot
+
+FEET = np.dtype([('feet', '<f8')])
+KELVIN = np.dtype([('kelvin', '<f8')])
+KNOTS = np.dtype([('knots', '<f8')])
+METRES = np.dtype([('metres', '<f8')])
+FEET32 = np.dtype([('feet', '<f4')])
+METRES32 = np.dtype([('metres', '<f4')])
+
+def test_float64_conversions():
+    values = np.arange(-1000.0, 1000.0, 0.5)
+
+    metres = feet_to_metres(values)
+    assert metres.dtype == np.float64
+    assert np.array_equal(values * METRES_PER_FOOT, metres)
+    assert np.array_equal(values / METRES_PER_FOOT, metres_to_feet(values))
+
+    metres = nautical_miles_to_metres(values)
+    assert np.array_equal(values * METRES_PER_NAUTICAL_MILE, metres)
+    assert np.array_equal(values / METRES_PER_NAUTICAL_MILE,
+                          metres_to_nautical_miles(values))
+
+    metres_per_second = knots_to_metres_per_second(values)
+    assert np.array_equal(values * METRES_PER_SECOND_TO_KNOTS,
+                          metres_per_second)
+    assert np.array_equal(values / METRES_PER_SECOND_TO_KNOTS,
+                          metres_per_second_to_knots(values))
+
+def test_float32_conversions():
+    values = np.arange(-1000.0, 1000.0, 0.5, dtype=np.float32)
+
+    metres = feet_to_metres(values)
+    assert metres.dtype == np.float32
+    assert np.array_equal(values * np.float32(METRES_PER_FOOT), metres)
+    assert np.array_equal(values / np.float32(METRES_PER_FOOT),
+                          metres_to_feet(values))
+
+    feet = values.view(FEET32)
+    metres = feet_to_metres(feet)
+    assert metres.dtype == METRES32
+    assert np.array_equal(values * np.float32(METRES_PER_FOOT),
+                          metres['metres'])
+
+def test_float32_widening_conversions():
+    values = np.array([1.0, -35000.0, 123.456], dtype=np.float32)
+
+    # float32 values are converted into float64 out arrays in float64
+    out = np.empty(3)
+    assert feet_to_metres(values, out=out) is out
+    assert np.array_equal(values.astype(np.float64) * METRES_PER_FOOT, out)
+
+    # float64 values are not converted into float32 out arrays
+    with pytest.raises(TypeError):
+        feet_to_metres(values.astype(np.float64),
+                       out=np.empty(3, dtype=np.float32))
+
+def test_float32_scalars():
+    metres = Metres32(1.5)
+    assert metres.v() == 1.5
+    assert repr(metres) == 'Metres32(1.5)'
+    assert Metres32(1.0) < metres
+    assert Feet32(metres).v() == pytest.approx(1.5 / METRES_PER_FOOT,
+                                               rel=1e-6)
+
+def test_scalar_results():
+    values = np.array([1.0, -35000.0, 123.456])
+    metres = feet_to_metres(values)
+    for value, result in zip(values, metres):
+        assert Feet(value).to_metres().v() == result
+
+    metres_per_second = knots_to_metres_per_second(values)
+    for value, result in zip(values, metres_per_second):
+        assert Knots(value).to_metres().v() == result
+
+def test_in_place_conversion():
+    values = np.array([1.0, 2.0, 3.0])
+    results = feet_to_metres(values, out=values)
+    assert results is values
+    assert np.array_equal(np.array([1.0, 2.0, 3.0]) * METRES_PER_FOOT, values)
+
+def test_overlapping_out_conversion():
+    # out overlaps values: the results are as if values were copied first
+    values = np.arange(0.0, 200000.0)
+    expected = feet_to_metres(values[:-1])
+    for nthreads in (1, 4):
+        buffer = values.copy()
+        feet_to_metres(buffer[:-1], out=buffer[1:], nthreads=nthreads)
+        assert np.array_equal(expected, buffer[1:])
+
+    buffer = values.copy()
+    feet_to_metres(buffer[1:], out=buffer[:-1])
+    assert np.array_equal(feet_to_metres(values[1:]), buffer[:-1])
+
+def test_out_conversion():
+    values = np.ones((2, 3))
+    out = np.empty((2, 3))
+    results = metres_to_nautical_miles(values, out=out)
+    assert results is out
+    assert np.all(out == 1.0 / METRES_PER_NAUTICAL_MILE)
+
+    with pytest.raises(ValueError):
+        metres_to_nautical_miles(values, out=np.empty(5))
+    with pytest.raises(TypeError):
+        metres_to_nautical_miles(values, out=np.empty(6, dtype=np.float32))
+
+def test_structured_conversions():
+    feet = np.zeros(4, dtype=FEET)
+    feet['feet'] = [0.0, 1.0, 1000.0, 35000.0]
+
+    metres = feet_to_metres(feet)
+    assert metres.dtype == METRES
+    assert np.array_equal(feet['feet'] * METRES_PER_FOOT, metres['metres'])
+
+    result = metres_to_feet(metres)
+    assert result.dtype == FEET
+
+    out = np.empty(4)
+    feet_to_metres(feet, out=out)
+    assert np.array_equal(metres['metres'], out)
+
+def test_threaded_conversions():
+    # larger than the parallel threshold, so the values are split into chunks
+    values = np.arange(0.0, 300000.0)
+    expected = feet_to_metres(values)
+    for nthreads in (0, 2, 4):
+        assert np.array_equal(expected,
+                              feet_to_metres(values, nthreads=nthreads))
+
+    float32 = values.astype(np.float32)
+    out = np.empty(len(values))
+    feet_to_metres(float32, out=out, nthreads=4)
+    assert np.array_equal(feet_to_metres(float32, out=np.empty(len(values))),
+                          out)
+
+    feet = values.view(FEET)
+    assert np.array_equal(astype(feet, Metres),
+                          astype(feet, Metres, nthreads=4))
+
+    with pytest.raises(ValueError):
+        feet_to_metres(values, nthreads=-1)
+    with pytest.raises(ValueError):
+        astype(feet, Metres, nthreads=-1)
+
+def test_wrong_unit():
+    metres = np.zeros(4, dtype=METRES)
+    with pytest.raises(TypeError):
+        feet_to_metres(metres)
+
+def test_list_conversion():
+    assert np.array_equal(np.array([METRES_PER_FOOT]), feet_to_metres([1]))
+
+def test_ufunc_arithmetic():
+    a = np.zeros(5, dtype=METRES)
+    a['metres'] = np.arange(5.0)
+    b = np.ones(5, dtype=METRES)
+
+    result = a + b
+    assert result.dtype == METRES
+    assert np.array_equal(np.arange(1.0, 6.0), result['metres'])
+
+    result = a - b
+    assert result.dtype == METRES
+    assert np.array_equal(np.arange(-1.0, 4.0), result['metres'])
+
+    result = -a
+    assert result.dtype == METRES
+    assert np.array_equal(-np.arange(5.0), result['metres'])
+
+    result = a[::2] + b[::2]
+    assert np.array_equal(np.array([1.0, 3.0, 5.0]), result['metres'])
+
+    out = np.empty(5, dtype=METRES)
+    np.add(a, b, out=out)
+    assert np.array_equal(np.arange(1.0, 6.0), out['metres'])
+
+def test_ufunc_comparison():
+    a = np.zeros(3, dtype=FEET)
+    a['feet'] = [1.0, 2.0, 3.0]
+    b = np.full(3, 2.0).view(FEET)
+
+    assert np.array_equal(np.array([True, False, False]), a < b)
+    assert np.array_equal(np.array([True, True, False]), a <= b)
+    assert np.array_equal(np.array([False, False, True]), a > b)
+    assert np.array_equal(np.array([False, True, True]), a >= b)
+    assert np.array_equal(np.array([False, True, False]), np.equal(a, b))
+    assert np.array_equal(np.array([True, False, True]), np.not_equal(a, b))
+
+def test_ufunc_mixed_units():
+    metres = np.ones(3, dtype=METRES)
+    with pytest.raises(TypeError):
+        metres + np.ones(3, dtype=KELVIN)
+    with pytest.raises(TypeError):
+        metres < np.ones(3, dtype=FEET)
+    with pytest.raises(TypeError):
+        np.ones(3, dtype=FEET) + np.ones(3, dtype=FEET)
+
+def test_astype():
+    feet = np.zeros(2, dtype=FEET)
+    feet['feet'] = [1.0, 35000.0]
+
+    metres = astype(feet, Metres)
+    assert metres.dtype == METRES
+    assert np.array_equal(feet['feet'] * METRES_PER_FOOT, metres['metres'])
+    assert astype(metres, Feet).dtype == FEET
+    assert astype(metres, NauticalMiles)['nautical_miles'][0] == \
+        METRES_PER_FOOT / METRES_PER_NAUTICAL_MILE
+
+    nautical_miles = astype(feet, NauticalMiles)
+    assert np.allclose(feet['feet'] * METRES_PER_FOOT / METRES_PER_NAUTICAL_MILE,
+                       nautical_miles['nautical_miles'], rtol=1e-15)
+    assert np.allclose(feet['feet'], astype(nautical_miles, Feet)['feet'],
+                       rtol=1e-15)
+
+    knots = np.ones(2, dtype=KNOTS)
+    assert astype(knots, MetresPerSecond)['metres_per_second'][0] == \
+        METRES_PER_SECOND_TO_KNOTS
+
+    with pytest.raises(TypeError):
+        astype(feet, Knots)
+
+def test_astype_float32():
+    feet = np.zeros(2, dtype=FEET32)
+    feet['feet'] = [1.0, 35000.0]
+
+    metres = astype(feet, Metres32)
+    assert metres.dtype == METRES32
+    assert np.array_equal(feet['feet'] * np.float32(METRES_PER_FOOT),
+                          metres['metres'])
+
+    metres = astype(feet, Metres)
+    assert metres.dtype == METRES
+    assert np.array_equal(feet['feet'].astype(np.float64) * METRES_PER_FOOT,
+                          metres['metres'])
+
+    nautical_miles = astype(feet, NauticalMiles32)
+    assert nautical_miles.dtype == np.dtype([('nautical_miles', '<f4')])
+
+def test_ufunc_float32():
+    a = np.ones(3, dtype=METRES32)
+    result = a + a
+    assert result.dtype == METRES32
+    assert np.array_equal(np.full(3, 2.0, dtype=np.float32), result['metres'])
+
+    with pytest.raises(TypeError):
+        a + np.ones(3, dtype=METRES)
+
+def test_unit_array_buffer_protocol():
+    metres = MetresArray(np.arange(5.0))
+    assert len(metres) == 5
+    assert metres.unit is Metres
+    assert metres[1] == Metres(1.0)
+    assert metres[-1] == Metres(4.0)
+    with pytest.raises(IndexError):
+        metres[5]
+
+    # numpy views the units without copying them
+    view = np.asarray(metres)
+    assert view.dtype == METRES
+    view['metres'][0] = 10.0
+    assert metres[0] == Metres(10.0)
+    metres[2] = Metres(-2.0)
+    assert view['metres'][2] == -2.0
+
+    values = metres.values
+    assert values.dtype == np.float64
+    assert np.shares_memory(values, view)
+
+    # the view keeps the array alive
+    del metres
+    assert np.array_equal(np.array([10.0, 1.0, -2.0, 3.0, 4.0]),
+                          view['metres'])
+
+    # the conversion functions accept arrays of units
+    feet = FeetArray(np.array([1.0, 2.0]))
+    assert np.array_equal(np.array([1.0, 2.0]) * METRES_PER_FOOT,
+                          feet_to_metres(feet)['metres'])
+    with pytest.raises(TypeError):
+        MetresArray(np.zeros(2, dtype=FEET))
+
+def test_unit_array_dlpack():
+    metres = Metres32Array(4)
+    assert metres.__dlpack_device__() == (1, 0)
+
+    values = np.from_dlpack(metres)
+    assert values.dtype == np.float32
+    assert np.array_equal(np.zeros(4, dtype=np.float32), values)
+    metres[3] = Metres32(3.0)
+    assert values[3] == 3.0
+
+    # the capsule keeps the array alive
+    del metres
+    assert values[3] == 3.0
+
+    metres = MetresArray(np.ones(3))
+    copy = np.from_dlpack(metres, copy=True)
+    assert not np.shares_memory(copy, np.asarray(metres))
+    assert np.array_equal(np.ones(3), copy)
+
+def test_trace():
+    trace_reset()
+    feet_to_metres(np.ones(100))
+    records = trace_snapshot()
+    if not TRACE_ENABLED:
+        assert records == []
+        return
+
+    record = next(r for r in records if r['function'] == 'to_metres')
+    assert record['units'] == 'Feet<double> -> Metres<double>'
+    assert record['calls'] == 1
+    assert record['elements'] == 100
+    assert record['batch_sizes'][1] == 1
+
+    trace_reset()
+    assert trace_snapshot() == []
+
+if __name__ == '__main__':
+    pytest.main()
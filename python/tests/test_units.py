@@ -54,7 +54,7 @@ def test_Metres():
     result += two
     assert one == result
 
-    assert "Metres(1.000000)" == repr(one)
+    assert "Metres(1)" == repr(one)
 
 def test_MetresPerSecond():
     zero = MetresPerSecond()
@@ -82,7 +82,7 @@ def test_MetresPerSecond():
     result += two
     assert one == result
 
-    assert "MetresPerSecond(1.000000)" == repr(one)
+    assert "MetresPerSecond(1)" == repr(one)
 
 def test_MetresPerSecondSquared():
     zero = MetresPerSecondSquared()
@@ -99,7 +99,7 @@ def test_MetresPerSecondSquared():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "MetresPerSecondSquared(1.000000)" == repr(one)
+    assert "MetresPerSecondSquared(1)" == repr(one)
 
 def test_Kelvin():
     one = Kelvin(1.0)
@@ -125,7 +125,7 @@ def test_Kelvin():
     result += two
     assert one == result
 
-    assert "Kelvin(1.000000)" == repr(one)
+    assert "Kelvin(1)" == repr(one)
 
 def test_Pascals():
     one = Pascals(1.0)
@@ -140,7 +140,7 @@ def test_Pascals():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "Pascals(1.000000)" == repr(one)
+    assert "Pascals(1)" == repr(one)
 
 def test_Kilograms():
     zero = Kilograms()
@@ -168,7 +168,7 @@ def test_Kilograms():
     result += two
     assert one == result
 
-    assert "Kilograms(1.000000)" == repr(one)
+    assert "Kilograms(1)" == repr(one)
 
 def test_KilogramsPerCubicMetre():
     one = KilogramsPerCubicMetre(1.0)
@@ -183,7 +183,7 @@ def test_KilogramsPerCubicMetre():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "KilogramsPerCubicMetre(1.000000)" == repr(one)
+    assert "KilogramsPerCubicMetre(1)" == repr(one)
 
 def test_NauticalMiles():
     one = NauticalMiles(1.0)
@@ -198,7 +198,7 @@ def test_NauticalMiles():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "NauticalMiles(1.000000)" == repr(one)
+    assert "NauticalMiles(1)" == repr(one)
 
 def test_NauticalMiles_conversion():
     one_nm = NauticalMiles(1.0)
@@ -222,7 +222,7 @@ def test_Feet():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "Feet(1.000000)" == repr(one)
+    assert "Feet(1)" == repr(one)
 
 def test_Feet_conversion():
     one_nm = Feet(1.0)
@@ -246,7 +246,7 @@ def test_Knots():
     assert one > minus_one
     assert one >= minus_one
 
-    assert "Knots(1.000000)" == repr(one)
+    assert "Knots(1)" == repr(one)
 
 def test_Knots_conversion():
     one_kt = Knots(1.0)
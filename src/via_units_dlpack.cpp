@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file via_units_dlpack.cpp
+/// @brief Contains the DLPack export of arrays of via::units values.
+///
+/// The DLPack structs are declared here with the layout of the DLPack 0.8
+/// ABI, which every DLPack consumer accepts, instead of depending on
+/// dlpack.h.
+//////////////////////////////////////////////////////////////////////////////
+#define PY_SSIZE_T_CLEAN
+#include "via_units_dlpack.hpp"
+#include <new>
+
+namespace via_units_python {
+namespace {
+
+/// The DLPack CPU device type.
+constexpr std::int32_t DL_CPU{1};
+
+/// The DLPack floating point type code.
+constexpr std::uint8_t DL_FLOAT{2};
+
+struct DLDevice {
+  std::int32_t device_type;
+  std::int32_t device_id;
+};
+
+struct DLDataType {
+  std::uint8_t code;
+  std::uint8_t bits;
+  std::uint16_t lanes;
+};
+
+struct DLTensor {
+  void *data;
+  DLDevice device;
+  std::int32_t ndim;
+  DLDataType dtype;
+  std::int64_t *shape;
+  std::int64_t *strides;
+  std::uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void *manager_ctx;
+  void (*deleter)(DLManagedTensor *self);
+};
+
+/// The name of an unconsumed DLPack capsule.
+constexpr const char *DLTENSOR{"dltensor"};
+
+/// A DLPack tensor with its shape and a reference to the owner of its data.
+struct ManagedArray {
+  DLManagedTensor tensor;
+  std::int64_t shape[1];
+  PyObject *owner;
+};
+
+/// The DLPack deleter: releases the owner of the data.
+/// The consumer may call it from any thread, without the GIL.
+void delete_managed_array(DLManagedTensor *self) {
+  auto *array{static_cast<ManagedArray *>(self->manager_ctx)};
+  const auto state{PyGILState_Ensure()};
+  Py_DECREF(array->owner);
+  PyGILState_Release(state);
+  delete array;
+}
+
+/// The capsule destructor: deletes the DLPack tensor if it was not consumed.
+/// A consumer renames the capsule to "used_dltensor" and takes ownership of
+/// the tensor.
+void delete_capsule(PyObject *capsule) {
+  if (!PyCapsule_IsValid(capsule, DLTENSOR))
+    return;
+
+  auto *tensor{static_cast<DLManagedTensor *>(
+      PyCapsule_GetPointer(capsule, DLTENSOR))};
+  tensor->deleter(tensor);
+}
+
+} // namespace
+
+auto to_dlpack(void *data, const std::int64_t size, const std::uint8_t bits,
+               PyObject *owner) -> PyObject * {
+  auto *array{new (std::nothrow) ManagedArray{}};
+  if (!array)
+    return PyErr_NoMemory();
+
+  array->shape[0] = size;
+  array->owner = owner;
+  array->tensor.dl_tensor = {data,    {DL_CPU, 0},  1, {DL_FLOAT, bits, 1},
+                             array->shape, nullptr, 0};
+  array->tensor.manager_ctx = array;
+  array->tensor.deleter = delete_managed_array;
+
+  Py_INCREF(owner);
+  PyObject *capsule{PyCapsule_New(&array->tensor, DLTENSOR, delete_capsule)};
+  if (!capsule)
+    delete_managed_array(&array->tensor);
+  return capsule;
+}
+
+} // namespace via_units_python
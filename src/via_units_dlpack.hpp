@@ -0,0 +1,46 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file via_units_dlpack.hpp
+/// @brief Contains the DLPack export of arrays of via::units values.
+//////////////////////////////////////////////////////////////////////////////
+#include <Python.h>
+#include <cstdint>
+
+namespace via_units_python {
+
+/// Export a contiguous one dimensional array of floating point values as
+/// an unversioned DLPack "dltensor" capsule on the CPU device.
+///
+/// The DLPack tensor holds a reference to `owner`, which owns the values,
+/// until the consumer of the capsule calls its deleter, or until the
+/// capsule is destroyed without being consumed.
+/// @param data the values.
+/// @param size the number of values.
+/// @param bits the size of each value in bits: 32 or 64.
+/// @param owner the Python object that owns the values.
+/// @return the capsule, otherwise nullptr with a Python exception set.
+auto to_dlpack(void *data, std::int64_t size, std::uint8_t bits,
+               PyObject *owner) -> PyObject *;
+
+} // namespace via_units_python
@@ -27,226 +27,696 @@
 #include <pybind11/numpy.h>
 #include "via/units.hpp"
 // clang-format on
+#include "via_units_dlpack.hpp"
+#include "via_units_ufuncs.hpp"
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
 
-PYBIND11_MODULE(via_units, m) {
-  try {
-    py::module::import("numpy");
-  } catch (...) {
-    return;
+namespace {
+/// The unit type U with value type T, e.g. Metres<float> from Metres<double>.
+template <typename U, typename T>
+using WithValueType =
+    via::units::Quantity<typename U::dimension, typename U::ratio, T>;
+
+/// Convert an array of `From` units to an array of `To` units.
+/// The array may have the registered numpy dtype of `From` or be an array
+/// of float64 values, or the float32 equivalents.
+/// The results are written to `out` if it is provided, otherwise to a new
+/// array of `To` units or values of the same precision as the array.
+/// float32 arrays may be converted to float64 `out` arrays, in float64;
+/// float64 arrays are not converted to float32 `out` arrays.
+/// The conversion is performed on the array memory, without the GIL.
+/// If `out` overlaps `values`, other than in place, a copy of `values` is
+/// converted.
+/// @param values the array to convert.
+/// @param out the array for the results: may be None or `values`.
+/// @param policy the execution policy of the conversion.
+/// @param kernel the batch conversion function: kernel(policy, in, out).
+/// @param from the name of the `From` type, for error messages.
+/// @param to the name of the `To` type, for error messages.
+/// @return the array of results.
+template <typename From, typename To, typename Kernel>
+auto convert_array(py::array values, const py::object &out,
+                   const via::units::Parallel &policy, Kernel kernel,
+                   const std::string &from, const std::string &to)
+    -> py::array {
+  using From32 = WithValueType<From, float>;
+  using To32 = WithValueType<To, float>;
+
+  const bool is_single{
+      py::isinstance<py::array_t<From32, py::array::c_style>>(values) ||
+      py::isinstance<py::array_t<float>>(values)};
+  const bool is_units{
+      py::isinstance<py::array_t<From, py::array::c_style>>(values) ||
+      py::isinstance<py::array_t<From32, py::array::c_style>>(values)};
+  if (!is_units) {
+    if (values.dtype().kind() == 'V')
+      throw py::type_error("expected an array of " + from +
+                           ", float32 or float64");
+    if (is_single)
+      values = py::array_t<float, py::array::c_style | py::array::forcecast>::
+          ensure(values);
+    else
+      values = py::array_t<double, py::array::c_style | py::array::forcecast>::
+          ensure(values);
+    if (!values)
+      throw py::type_error("expected an array of " + from +
+                           ", float32 or float64");
   }
 
-  // Python bindings for constants
-  m.attr("METRES_PER_NAUTICAL_MILE") =
-      via::units::non_si::METRES_PER_NAUTICAL_MILE<double>;
-  m.attr("METRES_PER_FOOT") = via::units::non_si::METRES_PER_FOOT<double>;
-  m.attr("METRES_PER_SECOND_TO_KNOTS") =
-      via::units::non_si::METRES_PER_SECOND_TO_KNOTS<double>;
+  py::array results;
+  bool is_single_result{is_single};
+  if (out.is_none()) {
+    const std::vector<py::ssize_t> shape(values.shape(),
+                                         values.shape() + values.ndim());
+    if (is_units)
+      results = is_single ? py::array(py::array_t<To32>(shape))
+                          : py::array(py::array_t<To>(shape));
+    else
+      results = is_single ? py::array(py::array_t<float>(shape))
+                          : py::array(py::array_t<double>(shape));
+  } else {
+    is_single_result =
+        py::isinstance<py::array_t<To32, py::array::c_style>>(out) ||
+        py::isinstance<py::array_t<float, py::array::c_style>>(out);
+    const bool is_double_result{
+        py::isinstance<py::array_t<To, py::array::c_style>>(out) ||
+        py::isinstance<py::array_t<double, py::array::c_style>>(out)};
+    if (!is_single_result && !is_double_result)
+      throw py::type_error("out must be a contiguous array of " + to +
+                           ", float32 or float64");
+    if (is_single_result && !is_single)
+      throw py::type_error("out must be float64 for float64 values");
+    results = py::reinterpret_borrow<py::array>(out);
+    if (!results.writeable())
+      throw py::value_error("out must be writeable");
+    if (results.size() != values.size())
+      throw py::value_error("out must be the same size as the array");
+  }
+
+  // An out array that overlaps values, other than in place, would be
+  // written before it is read: convert a copy of values, as numpy does.
+  const auto src_first{reinterpret_cast<std::uintptr_t>(values.data())};
+  const auto dst_first{reinterpret_cast<std::uintptr_t>(results.data())};
+  const bool in_place{src_first == dst_first &&
+                      values.itemsize() == results.itemsize()};
+  if (!in_place &&
+      src_first < dst_first + static_cast<std::uintptr_t>(results.nbytes()) &&
+      dst_first < src_first + static_cast<std::uintptr_t>(values.nbytes()))
+    values = values.attr("copy")().cast<py::array>();
+
+  // Only the array memory is used without the GIL: the arrays are owned by
+  // values and results, which are not touched until the GIL is reacquired.
+  const auto size{static_cast<std::size_t>(values.size())};
+  const void *src{values.data()};
+  void *dst{results.mutable_data()};
+  {
+    py::gil_scoped_release release;
+    if (!is_single)
+      kernel(policy,
+             std::span<const From>(static_cast<const From *>(src), size),
+             std::span<To>(static_cast<To *>(dst), size));
+    else if (is_single_result)
+      kernel(policy,
+             std::span<const From32>(static_cast<const From32 *>(src), size),
+             std::span<To32>(static_cast<To32 *>(dst), size));
+    else
+      via::units::convert(
+          policy,
+          std::span<const From32>(static_cast<const From32 *>(src), size),
+          std::span<To>(static_cast<To *>(dst), size));
+  }
+  return results;
+}
+
+/// Convert an array of `From` units to `To` units, if `unit` is the Python
+/// class of `To` and `values` is an array of `From` units, or the float32
+/// equivalents. An array of float32 `From` units may also be converted to
+/// `To` float64 units.
+/// @param values the array to convert.
+/// @param unit the Python class of the unit to convert to.
+/// @param policy the execution policy of the conversion.
+/// @param kernel the batch conversion function: kernel(policy, in, out).
+/// @return the array of `To` units, std::nullopt if not applicable.
+template <typename From, typename To, typename Kernel>
+auto try_astype(const py::array &values, const py::object &unit,
+                const via::units::Parallel &policy, Kernel kernel)
+    -> std::optional<py::array> {
+  using From32 = WithValueType<From, float>;
+  using To32 = WithValueType<To, float>;
+
+  if (unit.is(py::type::of<To>()) && py::isinstance<py::array_t<From>>(values))
+    return convert_array<From, To>(
+        py::array_t<From, py::array::c_style>::ensure(values), py::none(),
+        policy, kernel, "", "");
+
+  if (!py::isinstance<py::array_t<From32>>(values))
+    return std::nullopt;
+  const auto single{py::array_t<From32, py::array::c_style>::ensure(values)};
+  if (unit.is(py::type::of<To32>()))
+    return convert_array<From, To>(single, py::none(), policy, kernel, "",
+                                   "");
+  if (unit.is(py::type::of<To>())) {
+    const std::vector<py::ssize_t> shape(values.shape(),
+                                         values.shape() + values.ndim());
+    return convert_array<From, To>(single, py::array_t<To>(shape), policy,
+                                   kernel, "", "");
+  }
+  return std::nullopt;
+}
+
+/// The execution policy for the `nthreads` argument of the array functions.
+/// It converts to the `Parallel` policy of the batch functions and keeps its
+/// thread pool alive while they run, if another call replaces the pool.
+struct ThreadsPolicy {
+  std::shared_ptr<via::units::ThreadPool> pool;
+  via::units::Parallel parallel;
+
+  operator const via::units::Parallel &() const noexcept { return parallel; }
+};
+
+/// The execution policy for the `nthreads` argument of the array functions:
+/// 1 converts on the calling thread, 0 on a thread for each hardware thread
+/// and n on a pool of n threads, at most the number of hardware threads.
+/// The pools of n threads share a single pool, which is replaced when a call
+/// requests a different number of threads.
+/// @param nthreads the number of threads.
+/// @return the execution policy.
+auto execution_policy(const int nthreads) -> ThreadsPolicy {
+  if (nthreads < 0)
+    throw py::value_error("nthreads must not be negative");
+  if (nthreads == 1)
+    return {.pool = nullptr,
+            .parallel = {.threshold = std::numeric_limits<std::size_t>::max()}};
+
+  const std::size_t hardware{std::max(1u, std::thread::hardware_concurrency())};
+  const auto threads{std::min(static_cast<std::size_t>(nthreads), hardware)};
+  if (nthreads == 0 || threads == hardware)
+    return {};
+
+  static std::mutex mutex;
+  static std::shared_ptr<via::units::ThreadPool> shared;
+  const std::lock_guard lock{mutex};
+  if (!shared || shared->size() != threads)
+    shared = std::make_shared<via::units::ThreadPool>(threads);
+  return {.pool = shared, .parallel = {.pool = shared.get()}};
+}
+
+/// Bind a unit class with its value constructor, accessor, repr and
+/// comparison operators.
+/// @param m the module.
+/// @param name the name of the class.
+/// @param suffix the suffix of the class name, e.g. "32" for float units.
+/// @return the class, to bind its other methods.
+template <typename U>
+auto bind_unit(py::module &m, const char *name, const std::string &suffix)
+    -> py::class_<U> {
+  const auto class_name{name + suffix};
+  py::class_<U> unit(m, class_name.c_str());
+  unit.def(py::init<typename U::value_type>())
+
+      .def("v", &U::v)
+      .def("__repr__",
+           [suffix](const U &u) {
+             auto repr{u.python_repr()};
+             return repr.insert(repr.find('('), suffix);
+           })
+
+      .def(py::self < py::self)
+      .def(py::self <= py::self)
+      .def(py::self > py::self)
+      .def(py::self >= py::self)
+      .def(py::self == py::self);
+  return unit;
+}
+
+/// Bind an array of units: a UnitColumn of U, owned by C++, which exposes
+/// its units to numpy with the buffer protocol and its values to other
+/// libraries with DLPack, without copying them.
+/// The array cannot be resized, so the exported memory remains valid for as
+/// long as the exporter holds a reference to the array.
+/// @param m the module.
+/// @param name the name of the unit class.
+/// @param suffix the suffix of the class name, e.g. "32" for float units.
+template <typename U>
+void bind_unit_array(py::module &m, const char *name,
+                     const std::string &suffix) {
+  using T = typename U::value_type;
+  using Column = via::units::UnitColumn<U>;
+
+  const auto class_name{name + suffix + "Array"};
+  py::class_<Column>(m, class_name.c_str(), py::buffer_protocol())
+      .def(py::init([](const py::ssize_t size) {
+             if (size < 0)
+               throw py::value_error("size must not be negative");
+             Column column(static_cast<std::size_t>(size));
+             std::ranges::fill(column.values(), T());
+             return column;
+           }),
+           py::arg("size"))
+      .def(py::init([name](py::array values) {
+             const auto expected{std::string("expected an array of ") + name +
+                                 " or floating point values"};
+             if (py::isinstance<py::array_t<U>>(values))
+               values = py::array_t<U, py::array::c_style>::ensure(values);
+             else if (values.dtype().kind() == 'V')
+               throw py::type_error(expected);
+             else
+               values = py::array_t<T, py::array::c_style |
+                                           py::array::forcecast>::ensure(values);
+             if (!values)
+               throw py::type_error(expected);
+             return Column(std::span<const U>(
+                 static_cast<const U *>(values.data()),
+                 static_cast<std::size_t>(values.size())));
+           }),
+           py::arg("values"))
+
+      .def_buffer([](Column &column) {
+        return py::buffer_info(column.data(), sizeof(U),
+                               py::format_descriptor<U>::format(), 1,
+                               {column.size()}, {sizeof(U)});
+      })
+      .def("__len__", &Column::size)
+      .def("__getitem__",
+           [](const Column &column, py::ssize_t index) {
+             const auto size{static_cast<py::ssize_t>(column.size())};
+             if (index < 0)
+               index += size;
+             if (index < 0 || index >= size)
+               throw py::index_error();
+             return column[static_cast<std::size_t>(index)];
+           })
+      .def("__setitem__",
+           [](Column &column, py::ssize_t index, const U unit) {
+             const auto size{static_cast<py::ssize_t>(column.size())};
+             if (index < 0)
+               index += size;
+             if (index < 0 || index >= size)
+               throw py::index_error();
+             column[static_cast<std::size_t>(index)] = unit;
+           })
+
+      // The unit of the array, since DLPack only records the value type.
+      .def_property_readonly(
+          "unit", [](const Column &) { return py::type::of<U>(); })
+      // A float array view of the values.
+      .def_property_readonly("values",
+                             [](const py::object &self) {
+                               auto &column{self.cast<Column &>()};
+                               return py::array_t<T>(
+                                   {column.size()}, {sizeof(T)},
+                                   column.values().data(), self);
+                             })
+
+      .def(
+          "__dlpack__",
+          [](const py::object &self, const py::object &stream,
+             const py::object &, const py::object &dl_device,
+             const py::object &copy) {
+            if (!stream.is_none())
+              throw py::buffer_error("stream must be None for CPU arrays");
+            if (!dl_device.is_none() &&
+                dl_device.cast<std::pair<int, int>>() != std::pair{1, 0})
+              throw py::buffer_error("only the CPU device is supported");
+
+            // A copy is exported with a new array that owns it.
+            const py::object owner{
+                !copy.is_none() && copy.cast<bool>()
+                    ? py::cast(Column(self.cast<const Column &>()))
+                    : self};
+            auto &column{owner.cast<Column &>()};
+            PyObject *capsule{via_units_python::to_dlpack(
+                column.values().data(),
+                static_cast<std::int64_t>(column.size()), 8 * sizeof(T),
+                owner.ptr())};
+            if (!capsule)
+              throw py::error_already_set();
+            return py::reinterpret_steal<py::object>(capsule);
+          },
+          py::kw_only(), py::arg("stream") = py::none(),
+          py::arg("max_version") = py::none(),
+          py::arg("dl_device") = py::none(), py::arg("copy") = py::none())
+      .def("__dlpack_device__",
+           [](const Column &) { return py::make_tuple(1, 0); });
+}
+
+/// Bind the unit classes and numpy dtypes with value type T.
+/// @param m the module.
+/// @param suffix the suffix of the class names, e.g. "32" for float units.
+template <typename T> void bind_units(py::module &m, const std::string &suffix) {
+  using namespace via::units;
 
   // SI Units
 
   // Python numpy binding for the Metres class
-  PYBIND11_NUMPY_DTYPE(via::units::si::Metres<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::Metres<T>, v_, "metres");
 
   // Python bindings for the Metres class
-  py::class_<via::units::si::Metres<double>>(m, "Metres")
+  bind_unit<si::Metres<T>>(m, "Metres", suffix)
       .def(py::init<>())
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::Metres<double>::v)
-      .def("__repr__", &via::units::si::Metres<double>::python_repr)
 
       .def(py::self + py::self)
       .def(py::self += py::self)
       .def(-py::self)
       .def(py::self - py::self)
-      .def(py::self -= py::self)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def(py::self -= py::self);
 
   // Python numpy binding for the MetresPerSecond class
-  PYBIND11_NUMPY_DTYPE(via::units::si::MetresPerSecond<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::MetresPerSecond<T>, v_, "metres_per_second");
 
   // Python bindings for the MetresPerSecond class
-  py::class_<via::units::si::MetresPerSecond<double>>(m, "MetresPerSecond")
+  bind_unit<si::MetresPerSecond<T>>(m, "MetresPerSecond", suffix)
       .def(py::init<>())
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::MetresPerSecond<double>::v)
-      .def("__repr__", &via::units::si::MetresPerSecond<double>::python_repr)
 
       .def(py::self + py::self)
       .def(py::self += py::self)
       .def(-py::self)
       .def(py::self - py::self)
-      .def(py::self -= py::self)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def(py::self -= py::self);
 
   // Python numpy binding for the MetresPerSecondSquared class
-  PYBIND11_NUMPY_DTYPE(via::units::si::MetresPerSecondSquared<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::MetresPerSecondSquared<T>, v_,
+                          "metres_per_second_squared");
 
   // Python bindings for the MetresPerSecondSquared class
-  py::class_<via::units::si::MetresPerSecondSquared<double>>(
-      m, "MetresPerSecondSquared")
-      .def(py::init<>())
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::MetresPerSecondSquared<double>::v)
-      .def("__repr__",
-           &via::units::si::MetresPerSecondSquared<double>::python_repr)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+  bind_unit<si::MetresPerSecondSquared<T>>(m, "MetresPerSecondSquared", suffix)
+      .def(py::init<>());
 
   // Python numpy binding for the Kelvin class
-  PYBIND11_NUMPY_DTYPE(via::units::si::Kelvin<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::Kelvin<T>, v_, "kelvin");
 
   // Python bindings for the Kelvin class
-  py::class_<via::units::si::Kelvin<double>>(m, "Kelvin")
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::Kelvin<double>::v)
-      .def("__repr__", &via::units::si::Kelvin<double>::python_repr)
-
+  bind_unit<si::Kelvin<T>>(m, "Kelvin", suffix)
       .def(py::self + py::self)
       .def(py::self += py::self)
       .def(-py::self)
       .def(py::self - py::self)
-      .def(py::self -= py::self)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def(py::self -= py::self);
 
   // Python numpy binding for the Pascals class
-  PYBIND11_NUMPY_DTYPE(via::units::si::Pascals<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::Pascals<T>, v_, "pascals");
 
   // Python bindings for the Pascals class
-  py::class_<via::units::si::Pascals<double>>(m, "Pascals")
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::Pascals<double>::v)
-      .def("__repr__", &via::units::si::Pascals<double>::python_repr)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+  bind_unit<si::Pascals<T>>(m, "Pascals", suffix);
 
   // Python numpy binding for the Kilograms class
-  PYBIND11_NUMPY_DTYPE(via::units::si::Kilograms<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::Kilograms<T>, v_, "kilograms");
 
   // Python bindings for the Kilograms class
-  py::class_<via::units::si::Kilograms<double>>(m, "Kilograms")
+  bind_unit<si::Kilograms<T>>(m, "Kilograms", suffix)
       .def(py::init<>())
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::Kilograms<double>::v)
-      .def("__repr__", &via::units::si::Kilograms<double>::python_repr)
 
       .def(py::self + py::self)
       .def(py::self += py::self)
       .def(-py::self)
       .def(py::self - py::self)
-      .def(py::self -= py::self)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def(py::self -= py::self);
 
   // Python numpy binding for the KilogramsPerCubicMetre class
-  PYBIND11_NUMPY_DTYPE(via::units::si::KilogramsPerCubicMetre<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(si::KilogramsPerCubicMetre<T>, v_,
+                          "kilograms_per_cubic_metre");
 
   // Python bindings for the KilogramsPerCubicMetre class
-  py::class_<via::units::si::KilogramsPerCubicMetre<double>>(
-      m, "KilogramsPerCubicMetre")
-      .def(py::init<double>())
-
-      .def("v", &via::units::si::KilogramsPerCubicMetre<double>::v)
-      .def("__repr__",
-           &via::units::si::KilogramsPerCubicMetre<double>::python_repr)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+  bind_unit<si::KilogramsPerCubicMetre<T>>(m, "KilogramsPerCubicMetre", suffix);
 
   // Non-SI Units
 
   // Python numpy binding for the NauticalMiles class
-  PYBIND11_NUMPY_DTYPE(via::units::non_si::NauticalMiles<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(non_si::NauticalMiles<T>, v_, "nautical_miles");
 
   // Python bindings for the NauticalMiles class
-  py::class_<via::units::non_si::NauticalMiles<double>>(m, "NauticalMiles")
-      .def(py::init<double>())
-      .def(py::init<via::units::si::Metres<double>>())
+  bind_unit<non_si::NauticalMiles<T>>(m, "NauticalMiles", suffix)
+      .def(py::init<si::Metres<T>>())
 
-      .def("to_metres", &via::units::non_si::NauticalMiles<double>::to_metres)
-      .def("v", &via::units::non_si::NauticalMiles<double>::v)
-      .def("__repr__", &via::units::non_si::NauticalMiles<double>::python_repr)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def("to_metres", &non_si::NauticalMiles<T>::to_metres);
 
   // Python numpy binding for the Feet class
-  PYBIND11_NUMPY_DTYPE(via::units::non_si::Feet<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(non_si::Feet<T>, v_, "feet");
 
   // Python bindings for the Feet class
-  py::class_<via::units::non_si::Feet<double>>(m, "Feet")
-      .def(py::init<double>())
-      .def(py::init<via::units::si::Metres<double>>())
+  bind_unit<non_si::Feet<T>>(m, "Feet", suffix)
+      .def(py::init<si::Metres<T>>())
 
-      .def("to_metres", &via::units::non_si::Feet<double>::to_metres)
-      .def("v", &via::units::non_si::Feet<double>::v)
-      .def("__repr__", &via::units::non_si::Feet<double>::python_repr)
-
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+      .def("to_metres", &non_si::Feet<T>::to_metres);
 
   // Python numpy binding for the Knots class
-  PYBIND11_NUMPY_DTYPE(via::units::non_si::Knots<double>, v_);
+  PYBIND11_NUMPY_DTYPE_EX(non_si::Knots<T>, v_, "knots");
 
   // Python bindings for the Knots class
-  py::class_<via::units::non_si::Knots<double>>(m, "Knots")
-      .def(py::init<double>())
-      .def(py::init<via::units::si::MetresPerSecond<double>>())
+  bind_unit<non_si::Knots<T>>(m, "Knots", suffix)
+      .def(py::init<si::MetresPerSecond<T>>())
+
+      .def("to_metres", &non_si::Knots<T>::to_metres_per_second);
+
+  // Arrays of units
+  bind_unit_array<si::Metres<T>>(m, "Metres", suffix);
+  bind_unit_array<si::MetresPerSecond<T>>(m, "MetresPerSecond", suffix);
+  bind_unit_array<si::MetresPerSecondSquared<T>>(m, "MetresPerSecondSquared",
+                                                 suffix);
+  bind_unit_array<si::Kelvin<T>>(m, "Kelvin", suffix);
+  bind_unit_array<si::Pascals<T>>(m, "Pascals", suffix);
+  bind_unit_array<si::Kilograms<T>>(m, "Kilograms", suffix);
+  bind_unit_array<si::KilogramsPerCubicMetre<T>>(m, "KilogramsPerCubicMetre",
+                                                 suffix);
+  bind_unit_array<non_si::NauticalMiles<T>>(m, "NauticalMiles", suffix);
+  bind_unit_array<non_si::Feet<T>>(m, "Feet", suffix);
+  bind_unit_array<non_si::Knots<T>>(m, "Knots", suffix);
+}
+} // namespace
 
-      .def("to_metres",
-           &via::units::non_si::Knots<double>::to_metres_per_second)
-      .def("v", &via::units::non_si::Knots<double>::v)
-      .def("__repr__", &via::units::non_si::Knots<double>::python_repr)
+PYBIND11_MODULE(via_units, m) {
+  try {
+    py::module::import("numpy");
+  } catch (...) {
+    return;
+  }
 
-      .def(py::self < py::self)
-      .def(py::self <= py::self)
-      .def(py::self > py::self)
-      .def(py::self >= py::self)
-      .def(py::self == py::self);
+  using via::units::non_si::Feet;
+  using via::units::non_si::Knots;
+  using via::units::non_si::NauticalMiles;
+  using via::units::si::Kelvin;
+  using via::units::si::Kilograms;
+  using via::units::si::KilogramsPerCubicMetre;
+  using via::units::si::Metres;
+  using via::units::si::MetresPerSecond;
+  using via::units::si::MetresPerSecondSquared;
+  using via::units::si::Pascals;
+
+  // Python bindings for constants
+  m.attr("METRES_PER_NAUTICAL_MILE") =
+      via::units::non_si::METRES_PER_NAUTICAL_MILE<double>;
+  m.attr("METRES_PER_FOOT") = via::units::non_si::METRES_PER_FOOT<double>;
+  m.attr("METRES_PER_SECOND_TO_KNOTS") =
+      via::units::non_si::METRES_PER_SECOND_TO_KNOTS<double>;
+
+  // The float64 unit classes, e.g. Metres, and the float32 unit classes,
+  // e.g. Metres32
+  bind_units<double>(m, "");
+  bind_units<float>(m, "32");
+
+  // Numpy ufunc loops for the unit dtypes
+  const via_units_python::UnitDtype arithmetic_dtypes[]{
+      {py::dtype::of<Metres<double>>().ptr(), "Metres"},
+      {py::dtype::of<MetresPerSecond<double>>().ptr(), "MetresPerSecond"},
+      {py::dtype::of<Kelvin<double>>().ptr(), "Kelvin"},
+      {py::dtype::of<Kilograms<double>>().ptr(), "Kilograms"},
+      {py::dtype::of<Metres<float>>().ptr(), "Metres32"},
+      {py::dtype::of<MetresPerSecond<float>>().ptr(), "MetresPerSecond32"},
+      {py::dtype::of<Kelvin<float>>().ptr(), "Kelvin32"},
+      {py::dtype::of<Kilograms<float>>().ptr(), "Kilograms32"}};
+  const via_units_python::UnitDtype comparable_dtypes[]{
+      {py::dtype::of<MetresPerSecondSquared<double>>().ptr(),
+       "MetresPerSecondSquared"},
+      {py::dtype::of<Pascals<double>>().ptr(), "Pascals"},
+      {py::dtype::of<KilogramsPerCubicMetre<double>>().ptr(),
+       "KilogramsPerCubicMetre"},
+      {py::dtype::of<NauticalMiles<double>>().ptr(), "NauticalMiles"},
+      {py::dtype::of<Feet<double>>().ptr(), "Feet"},
+      {py::dtype::of<Knots<double>>().ptr(), "Knots"},
+      {py::dtype::of<MetresPerSecondSquared<float>>().ptr(),
+       "MetresPerSecondSquared32"},
+      {py::dtype::of<Pascals<float>>().ptr(), "Pascals32"},
+      {py::dtype::of<KilogramsPerCubicMetre<float>>().ptr(),
+       "KilogramsPerCubicMetre32"},
+      {py::dtype::of<NauticalMiles<float>>().ptr(), "NauticalMiles32"},
+      {py::dtype::of<Feet<float>>().ptr(), "Feet32"},
+      {py::dtype::of<Knots<float>>().ptr(), "Knots32"}};
+  if (via_units_python::register_ufunc_loops(arithmetic_dtypes,
+                                             comparable_dtypes) < 0)
+    throw py::error_already_set();
+
+  // Array conversions
+
+  m.def(
+      "nautical_miles_to_metres",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<NauticalMiles<double>, Metres<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_metres(policy, in, results);
+            },
+            "NauticalMiles", "Metres");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "metres_to_nautical_miles",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<Metres<double>, NauticalMiles<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_nautical_miles(policy, in, results);
+            },
+            "Metres", "NauticalMiles");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "feet_to_metres",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<Feet<double>, Metres<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_metres(policy, in, results);
+            },
+            "Feet", "Metres");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "metres_to_feet",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<Metres<double>, Feet<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_feet(policy, in, results);
+            },
+            "Metres", "Feet");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "knots_to_metres_per_second",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<Knots<double>, MetresPerSecond<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_metres_per_second(policy, in, results);
+            },
+            "Knots", "MetresPerSecond");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "metres_per_second_to_knots",
+      [](const py::array &values, const py::object &out, const int nthreads) {
+        return convert_array<MetresPerSecond<double>, Knots<double>>(
+            values, out, execution_policy(nthreads),
+            [](const auto &policy, auto in, auto results) {
+              via::units::non_si::to_knots(policy, in, results);
+            },
+            "MetresPerSecond", "Knots");
+      },
+      py::arg("values"), py::kw_only(), py::arg("out") = py::none(),
+      py::arg("nthreads") = 1);
+
+  m.def(
+      "astype",
+      [](const py::array &values, const py::object &unit, const int nthreads) {
+        const auto parallel{execution_policy(nthreads)};
+        auto result{try_astype<NauticalMiles<double>, Metres<double>>(
+            values, unit, parallel, [](const auto &policy, auto in, auto out) {
+              via::units::non_si::to_metres(policy, in, out);
+            })};
+        if (!result)
+          result = try_astype<Metres<double>, NauticalMiles<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::non_si::to_nautical_miles(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<Feet<double>, Metres<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::non_si::to_metres(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<Metres<double>, Feet<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::non_si::to_feet(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<Feet<double>, NauticalMiles<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::convert(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<NauticalMiles<double>, Feet<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::convert(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<Knots<double>, MetresPerSecond<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::non_si::to_metres_per_second(policy, in, out);
+              });
+        if (!result)
+          result = try_astype<MetresPerSecond<double>, Knots<double>>(
+              values, unit, parallel,
+              [](const auto &policy, auto in, auto out) {
+                via::units::non_si::to_knots(policy, in, out);
+              });
+        if (!result)
+          throw py::type_error("astype: unsupported conversion from " +
+                               py::str(values.dtype()).cast<std::string>() +
+                               " to " + py::repr(unit).cast<std::string>());
+        return *result;
+      },
+      py::arg("values"), py::arg("unit"), py::kw_only(),
+      py::arg("nthreads") = 1);
+
+  // Tracing of the batch functions, see trace.hpp
+
+  m.attr("TRACE_ENABLED") = via::units::trace::ENABLED;
+
+  m.def("trace_snapshot", [] {
+    py::list records;
+    for (const auto &record : via::units::trace::snapshot()) {
+      py::dict dict;
+      dict["function"] = record.function;
+      dict["units"] = record.units;
+      dict["calls"] = record.calls;
+      dict["elements"] = record.elements;
+      dict["nanoseconds"] = record.nanoseconds;
+      dict["batch_sizes"] = py::cast(record.batch_sizes);
+      records.append(std::move(dict));
+    }
+    return records;
+  });
+
+  m.def("trace_reset", [] { via::units::trace::reset(); });
 }
@@ -0,0 +1,335 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file via_units_ufuncs.cpp
+/// @brief Contains the numpy ufunc loops for the via::units numpy dtypes.
+///
+/// The unit dtypes are structured dtypes, so they all share the numpy
+/// `VoidDType` class. A single ArrayMethod is registered per ufunc for
+/// `VoidDType` operands and its `resolve_descriptors` function checks that
+/// the operands have the same unit dtype.
+//////////////////////////////////////////////////////////////////////////////
+// clang-format off
+#define PY_SSIZE_T_CLEAN
+#define NPY_NO_DEPRECATED_API NPY_2_0_API_VERSION
+#define NPY_TARGET_VERSION NPY_2_0_API_VERSION
+#include "via_units_ufuncs.hpp"
+#include <numpy/arrayobject.h>
+#include <numpy/dtype_api.h>
+#include <numpy/ufuncobject.h>
+// clang-format on
+#include "via/units/simd.hpp"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+namespace via_units_python {
+namespace {
+
+/// A unit dtype that the loops have been registered for.
+struct Unit {
+  PyArray_Descr *descr;
+  const char *name;
+  bool arithmetic;
+};
+
+/// The registered unit dtypes.
+std::vector<Unit> units;
+
+/// Find the registered unit dtype of an operand dtype.
+/// @return the unit, nullptr if the dtype is not a unit dtype.
+auto find_unit(PyArray_Descr *descr) -> const Unit * {
+  for (const auto &unit : units)
+    if (PyArray_CanCastTypeTo(descr, unit.descr, NPY_EQUIV_CASTING))
+      return &unit;
+  return nullptr;
+}
+
+/// Raise a TypeError for operands with different or unsupported dtypes.
+auto unit_mismatch(PyArray_Descr *const *given_descrs, const int nargs)
+    -> NPY_CASTING {
+  const Unit *a{find_unit(given_descrs[0])};
+  const Unit *b{nargs > 1 ? find_unit(given_descrs[1]) : a};
+  if (a && a == b)
+    PyErr_Format(PyExc_TypeError, "via_units: unsupported operation on %s",
+                 a->name);
+  else if (a && b)
+    PyErr_Format(PyExc_TypeError,
+                 "via_units: unsupported operand units: %s and %s", a->name,
+                 b->name);
+  else
+    PyErr_Format(PyExc_TypeError, "via_units: unsupported operand dtype: %R",
+                 a ? given_descrs[1] : given_descrs[0]);
+  return static_cast<NPY_CASTING>(-1);
+}
+
+/// Resolve the descriptors of an operation on units of the same type.
+/// @param nin the number of inputs.
+/// @param unit_result whether the result is the unit, otherwise bool.
+/// @param arithmetic whether the operation requires an arithmetic unit.
+template <int nin, bool unit_result, bool arithmetic>
+auto resolve_descriptors(PyArrayMethodObject_tag *, PyArray_DTypeMeta *const *,
+                         PyArray_Descr *const *given_descrs,
+                         PyArray_Descr **loop_descrs, npy_intp *)
+    -> NPY_CASTING {
+  const Unit *unit{find_unit(given_descrs[0])};
+  if (!unit || (arithmetic && !unit->arithmetic))
+    return unit_mismatch(given_descrs, nin);
+
+  NPY_CASTING casting{NPY_NO_CASTING};
+  for (int i{0}; i < nin; ++i) {
+    if (find_unit(given_descrs[i]) != unit)
+      return unit_mismatch(given_descrs, nin);
+    if (!PyArray_EquivTypes(given_descrs[i], unit->descr))
+      casting = NPY_EQUIV_CASTING;
+  }
+
+  PyArray_Descr *const out{given_descrs[nin]};
+  if constexpr (unit_result) {
+    if (out && find_unit(out) != unit)
+      return unit_mismatch(given_descrs, nin);
+  }
+
+  for (int i{0}; i < nin; ++i) {
+    Py_INCREF(unit->descr);
+    loop_descrs[i] = unit->descr;
+  }
+  if constexpr (unit_result) {
+    Py_INCREF(unit->descr);
+    loop_descrs[nin] = unit->descr;
+    if (out && !PyArray_EquivTypes(out, unit->descr))
+      casting = NPY_EQUIV_CASTING;
+  } else {
+    loop_descrs[nin] = out ? out : PyArray_DescrFromType(NPY_BOOL);
+    if (out)
+      Py_INCREF(out);
+  }
+  return casting;
+}
+
+/// Load a value from a (possibly unaligned) array element.
+template <typename T> auto load(const char *p) noexcept -> T {
+  T value;
+  std::memcpy(&value, p, sizeof(T));
+  return value;
+}
+
+/// Store a value in a (possibly unaligned) array element.
+template <typename T> void store(char *p, const T value) noexcept {
+  std::memcpy(p, &value, sizeof(T));
+}
+
+/// Whether the array elements are contiguous and aligned values of T.
+template <typename T>
+auto is_contiguous(char *const *data, const npy_intp *strides, const int nargs)
+    -> bool {
+  for (int i{0}; i < nargs; ++i)
+    if (strides[i] != static_cast<npy_intp>(sizeof(T)) ||
+        reinterpret_cast<std::uintptr_t>(data[i]) % alignof(T))
+      return false;
+  return true;
+}
+
+/// The unit + operator.
+struct Add {
+  template <typename T> static auto apply(const T a, const T b) -> T {
+    return a + b;
+  }
+  template <typename T>
+  static void apply(std::span<const T> a, std::span<const T> b,
+                    std::span<T> out) {
+    via::units::simd::add(a, b, out);
+  }
+};
+
+/// The unit - operator.
+struct Subtract {
+  template <typename T> static auto apply(const T a, const T b) -> T {
+    return a - b;
+  }
+  template <typename T>
+  static void apply(std::span<const T> a, std::span<const T> b,
+                    std::span<T> out) {
+    via::units::simd::subtract(a, b, out);
+  }
+};
+
+/// The loop for binary operators returning units.
+template <typename T, typename Op>
+auto binary_loop(PyArrayMethod_Context *, char *const *data,
+                 const npy_intp *dimensions, const npy_intp *strides,
+                 NpyAuxData *) -> int {
+  const auto n{dimensions[0]};
+  if (is_contiguous<T>(data, strides, 3)) {
+    const auto size{static_cast<std::size_t>(n)};
+    Op::apply(std::span<const T>(reinterpret_cast<const T *>(data[0]), size),
+              std::span<const T>(reinterpret_cast<const T *>(data[1]), size),
+              std::span<T>(reinterpret_cast<T *>(data[2]), size));
+    return 0;
+  }
+
+  const char *a{data[0]};
+  const char *b{data[1]};
+  char *out{data[2]};
+  for (npy_intp i{0}; i < n;
+       ++i, a += strides[0], b += strides[1], out += strides[2])
+    store(out, Op::apply(load<T>(a), load<T>(b)));
+  return 0;
+}
+
+/// The loop for the unary minus operator, which is: T() - v.
+template <typename T>
+auto negative_loop(PyArrayMethod_Context *, char *const *data,
+                   const npy_intp *dimensions, const npy_intp *strides,
+                   NpyAuxData *) -> int {
+  const auto n{dimensions[0]};
+  const char *in{data[0]};
+  char *out{data[1]};
+  for (npy_intp i{0}; i < n; ++i, in += strides[0], out += strides[1])
+    store(out, T() - load<T>(in));
+  return 0;
+}
+
+/// The loop for comparison operators.
+template <typename T, typename Compare>
+auto compare_loop(PyArrayMethod_Context *, char *const *data,
+                  const npy_intp *dimensions, const npy_intp *strides,
+                  NpyAuxData *) -> int {
+  const auto n{dimensions[0]};
+  const char *a{data[0]};
+  const char *b{data[1]};
+  char *out{data[2]};
+  for (npy_intp i{0}; i < n;
+       ++i, a += strides[0], b += strides[1], out += strides[2])
+    *reinterpret_cast<npy_bool *>(out) =
+        Compare{}(load<T>(a), load<T>(b)) ? NPY_TRUE : NPY_FALSE;
+  return 0;
+}
+
+/// Get the loop for the value type of the unit dtype.
+template <PyArrayMethod_StridedLoop *double_loop,
+          PyArrayMethod_StridedLoop *float_loop>
+auto get_loop(PyArrayMethod_Context *context, int, int, const npy_intp *,
+              PyArrayMethod_StridedLoop **out_loop, NpyAuxData **out_transferdata,
+              NPY_ARRAYMETHOD_FLAGS *) -> int {
+  *out_transferdata = nullptr;
+  switch (PyDataType_ELSIZE(context->descriptors[0])) {
+  case sizeof(double):
+    *out_loop = double_loop;
+    return 0;
+  case sizeof(float):
+    *out_loop = float_loop;
+    return 0;
+  default:
+    PyErr_SetString(PyExc_TypeError, "via_units: unsupported unit dtype");
+    return -1;
+  }
+}
+
+/// Register an ArrayMethod on a numpy ufunc.
+/// @param name the name of the numpy ufunc.
+/// @param nin the number of inputs.
+/// @param dtypes the DTypes of the inputs and output.
+/// @param resolve the resolve_descriptors function.
+/// @param loop the get_loop function.
+/// @return 0 on success, otherwise -1 with a Python exception set.
+auto add_loop(const char *name, const int nin, PyArray_DTypeMeta **dtypes,
+              PyArrayMethod_ResolveDescriptors *resolve,
+              PyArrayMethod_GetLoop *loop) -> int {
+  PyObject *numpy{PyImport_ImportModule("numpy")};
+  if (!numpy)
+    return -1;
+  PyObject *ufunc{PyObject_GetAttrString(numpy, name)};
+  Py_DECREF(numpy);
+  if (!ufunc)
+    return -1;
+
+  PyType_Slot slots[]{{NPY_METH_resolve_descriptors,
+                       reinterpret_cast<void *>(resolve)},
+                      {NPY_METH_get_loop, reinterpret_cast<void *>(loop)},
+                      {0, nullptr}};
+  PyArrayMethod_Spec spec{"via_units_loop",
+                          nin,
+                          1,
+                          NPY_NO_CASTING,
+                          static_cast<NPY_ARRAYMETHOD_FLAGS>(0),
+                          dtypes,
+                          slots};
+  const int result{PyUFunc_AddLoopFromSpec(ufunc, &spec)};
+  Py_DECREF(ufunc);
+  return result;
+}
+
+/// Register a comparison ArrayMethod on a numpy ufunc.
+template <typename Compare> auto add_compare_loop(const char *name) -> int {
+  PyArray_DTypeMeta *dtypes[]{&PyArray_VoidDType, &PyArray_VoidDType,
+                              &PyArray_BoolDType};
+  return add_loop(name, 2, dtypes, &resolve_descriptors<2, false, false>,
+                  &get_loop<&compare_loop<double, Compare>,
+                            &compare_loop<float, Compare>>);
+}
+
+} // namespace
+
+auto register_ufunc_loops(std::span<const UnitDtype> arithmetic,
+                          std::span<const UnitDtype> comparable) -> int {
+  if (PyArray_ImportNumPyAPI() < 0 || _import_umath() < 0)
+    return -1;
+
+  for (const auto &unit : arithmetic) {
+    Py_INCREF(unit.dtype);
+    units.push_back(
+        {reinterpret_cast<PyArray_Descr *>(unit.dtype), unit.name, true});
+  }
+  for (const auto &unit : comparable) {
+    Py_INCREF(unit.dtype);
+    units.push_back(
+        {reinterpret_cast<PyArray_Descr *>(unit.dtype), unit.name, false});
+  }
+
+  PyArray_DTypeMeta *binary_dtypes[]{&PyArray_VoidDType, &PyArray_VoidDType,
+                                     &PyArray_VoidDType};
+  PyArray_DTypeMeta *unary_dtypes[]{&PyArray_VoidDType, &PyArray_VoidDType};
+  if (add_loop("add", 2, binary_dtypes, &resolve_descriptors<2, true, true>,
+               &get_loop<&binary_loop<double, Add>,
+                         &binary_loop<float, Add>>) < 0 ||
+      add_loop("subtract", 2, binary_dtypes,
+               &resolve_descriptors<2, true, true>,
+               &get_loop<&binary_loop<double, Subtract>,
+                         &binary_loop<float, Subtract>>) < 0 ||
+      add_loop("negative", 1, unary_dtypes,
+               &resolve_descriptors<1, true, true>,
+               &get_loop<&negative_loop<double>, &negative_loop<float>>) < 0)
+    return -1;
+
+  if (add_compare_loop<std::equal_to<>>("equal") < 0 ||
+      add_compare_loop<std::not_equal_to<>>("not_equal") < 0 ||
+      add_compare_loop<std::less<>>("less") < 0 ||
+      add_compare_loop<std::less_equal<>>("less_equal") < 0 ||
+      add_compare_loop<std::greater<>>("greater") < 0 ||
+      add_compare_loop<std::greater_equal<>>("greater_equal") < 0)
+    return -1;
+
+  return 0;
+}
+
+} // namespace via_units_python
@@ -0,0 +1,53 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file via_units_ufuncs.hpp
+/// @brief Contains the numpy ufunc loops for the via::units numpy dtypes.
+//////////////////////////////////////////////////////////////////////////////
+#include <Python.h>
+#include <span>
+
+namespace via_units_python {
+
+/// A registered numpy dtype of a unit type, and the name of the unit type.
+struct UnitDtype {
+  PyObject *dtype;
+  const char *name;
+};
+
+/// Register numpy ufunc loops for the unit dtypes.
+///
+/// Registers `add`, `subtract` and `negative` loops for the `arithmetic`
+/// dtypes and `equal`, `not_equal`, `less`, `less_equal`, `greater` and
+/// `greater_equal` loops for the `arithmetic` and `comparable` dtypes.
+/// The loops only accept operands with the same unit dtype and return
+/// the unit dtype, e.g.: Metres + Metres -> Metres.
+///
+/// Requires numpy 2.0 or later.
+/// @param arithmetic the dtypes of units that support +, - and <=>.
+/// @param comparable the dtypes of units that only support <=>.
+/// @return 0 on success, otherwise -1 with a Python exception set.
+auto register_ufunc_loops(std::span<const UnitDtype> arithmetic,
+                          std::span<const UnitDtype> comparable) -> int;
+
+} // namespace via_units_python
@@ -0,0 +1,318 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+/// @file
+/// @brief Contains tests for the airspeed conversions.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/airspeed.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::airspeed;
+using namespace via::units::non_si;
+using namespace via::units::si;
+
+// The scalar conversions are constexpr.
+static_assert(
+    convert<Tas<Knots<double>>>(Cas<Knots<double>>(Knots<double>(250)),
+                                Metres<double>(0)) >
+    Tas<Knots<double>>(Knots<double>(249.999)));
+static_assert(convert<Mach<double>>(Cas<Knots<double>>(Knots<double>(250)),
+                                    Feet<double>(35'000)) > Mach<double>(0.74));
+static_assert(!is_subsonic(Cas<Knots<double>>(Knots<double>(300)),
+                           Feet<double>(45'000)));
+static_assert(convert<Mach<double>>(Cas<Knots<double>>(Knots<double>(300)),
+                                    Feet<double>(45'000)) > Mach<double>(1));
+
+namespace {
+/// The ratio of the impact pressure to the pressure at a Mach number, from
+/// the subsonic compressible flow and Rayleigh supersonic pitot tube
+/// equations with `std::pow` in long double.
+auto reference_ratio(const long double mach) -> long double {
+  const long double m2{mach * mach};
+  return mach <= 1.0L ? std::pow(1.0L + 0.2L * m2, 3.5L) - 1.0L
+                      : std::pow(1.2L * m2, 3.5L) *
+                                std::pow(6.0L / (7.0L * m2 - 1.0L), 2.5L) -
+                            1.0L;
+}
+
+/// The Mach number of a CAS at a pressure ratio: the subsonic equation is
+/// inverted explicitly and the Rayleigh equation by bisection.
+auto reference_mach(const long double cas, const long double delta)
+    -> long double {
+  const long double a0{SEA_LEVEL_SPEED_OF_SOUND<double>.v()};
+  const long double qc{reference_ratio(cas / a0) / delta};
+  if (qc <= reference_ratio(1.0L))
+    return std::sqrt(5.0L * (std::pow(qc + 1.0L, 2.0L / 7.0L) - 1.0L));
+
+  long double low{1};
+  long double high{100};
+  for (int i{0}; i < 100; ++i) {
+    const long double mid{(low + high) / 2};
+    (reference_ratio(mid) < qc ? low : high) = mid;
+  }
+  return low;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_airspeed)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_reference) {
+  for (double feet{0}; feet <= 40'000; feet += 2'500) {
+    const Feet<double> altitude(feet);
+    const auto state{atmosphere(altitude)};
+    for (double knots{50}; knots <= 600; knots += 25) {
+      const long double expected{
+          reference_mach(knots * METRES_PER_SECOND_TO_KNOTS<long double>,
+                         state.pressure_ratio)};
+      const Cas<Knots<double>> cas(Knots<double>{knots});
+      const auto mach{convert<Mach<double>>(cas, altitude)};
+      BOOST_CHECK_CLOSE(static_cast<double>(expected), mach.v(), 1e-11);
+
+      const auto tas{convert<Tas<MetresPerSecond<double>>>(cas, altitude)};
+      BOOST_CHECK_CLOSE(static_cast<double>(expected) * state.speed_of_sound,
+                        tas.v(), 1e-11);
+    }
+  }
+
+  // 250 kt CAS at FL350 is Mach 0.74 and 427 kt TAS.
+  const Cas<Knots<double>> cas(Knots<double>(250));
+  const Feet<double> altitude(35'000);
+  BOOST_CHECK_CLOSE(0.7412, convert<Mach<double>>(cas, altitude).v(), 0.01);
+  BOOST_CHECK_CLOSE(427.24, convert<Tas<Knots<double>>>(cas, altitude).v(),
+                    0.01);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_high_altitude) {
+  // Mach 1 is a CAS of 279 kt at FL450, so a subsonic CAS may be supersonic.
+  const Feet<double> altitude(45'000);
+  BOOST_CHECK_CLOSE(
+      278.79,
+      convert<Cas<Knots<double>>>(Mach<double>(1), altitude).v(), 0.01);
+  BOOST_CHECK_CLOSE(
+      443.28,
+      convert<Cas<Knots<double>>>(Mach<double>(1.5), altitude).v(), 0.01);
+  BOOST_CHECK_CLOSE(
+      1.5,
+      convert<Mach<double>>(Cas<Knots<double>>(Knots<double>(443.2774)),
+                            altitude)
+          .v(),
+      1e-4);
+  BOOST_CHECK(is_subsonic(Cas<Knots<double>>(Knots<double>(278)), altitude));
+  BOOST_CHECK(!is_subsonic(Cas<Knots<double>>(Knots<double>(280)), altitude));
+  BOOST_CHECK(!is_subsonic(Mach<double>(1.2), altitude));
+  BOOST_CHECK(is_subsonic(Tas<Knots<double>>(Knots<double>(550)), altitude));
+
+  // A CAS is the TAS at mean sea level in the ISA, also above Mach 1.
+  for (double knots{600}; knots <= 1'200; knots += 50)
+    BOOST_CHECK_CLOSE(knots,
+                      convert<Tas<Knots<double>>>(
+                          Cas<Knots<double>>(Knots<double>(knots)),
+                          Metres<double>(0))
+                          .v(),
+                      1e-11);
+
+  // The subsonic and supersonic CASs up to FL510 match the reference.
+  std::vector<Cas<Knots<double>>> cas;
+  std::vector<Feet<double>> altitudes;
+  for (double feet{41'000}; feet <= 51'000; feet += 1'000) {
+    const Feet<double> level(feet);
+    const auto state{atmosphere(level)};
+    for (double knots{100}; knots <= 500; knots += 5) {
+      const Cas<Knots<double>> speed(Knots<double>{knots});
+      const long double expected{
+          reference_mach(knots * METRES_PER_SECOND_TO_KNOTS<long double>,
+                         state.pressure_ratio)};
+      BOOST_CHECK_CLOSE(static_cast<double>(expected),
+                        convert<Mach<double>>(speed, level).v(), 1e-11);
+      cas.push_back(speed);
+      altitudes.push_back(level);
+    }
+  }
+
+  std::vector<Mach<double>> mach(cas.size());
+  convert<Mach<double>>(std::span<const Cas<Knots<double>>>(cas),
+                        std::span<const Feet<double>>(altitudes),
+                        std::span<Mach<double>>(mach));
+  for (std::size_t i{0}; i < cas.size(); ++i)
+    BOOST_CHECK_CLOSE(convert<Mach<double>>(cas[i], altitudes[i]).v(),
+                      mach[i].v(), 1e-12);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_round_trips) {
+  const Feet<double> altitude(28'000);
+  const Kelvin<double> deviation(12);
+  const Cas<Knots<double>> cas(Knots<double>(310));
+
+  const auto mach{convert<Mach<double>>(cas, altitude, deviation)};
+  const auto eas{convert<Eas<Knots<double>>>(cas, altitude, deviation)};
+  const auto tas{
+      convert<Tas<MetresPerSecond<double>>>(cas, altitude, deviation)};
+
+  BOOST_CHECK_CLOSE(cas.v(), convert<Cas<Knots<double>>>(mach, altitude).v(),
+                    1e-12);
+  BOOST_CHECK_CLOSE(
+      cas.v(), convert<Cas<Knots<double>>>(eas, altitude, deviation).v(),
+      1e-12);
+  BOOST_CHECK_CLOSE(
+      cas.v(), convert<Cas<Knots<double>>>(tas, altitude, deviation).v(),
+      1e-12);
+  BOOST_CHECK_CLOSE(mach.v(),
+                    convert<Mach<double>>(tas, altitude, deviation).v(), 1e-12);
+  BOOST_CHECK_CLOSE(eas.v(),
+                    convert<Eas<Knots<double>>>(tas, altitude, deviation).v(),
+                    1e-12);
+
+  // Converting between units of the same kind does not use the atmosphere.
+  BOOST_CHECK_EQUAL(
+      tas.speed(),
+      convert<Tas<MetresPerSecond<double>>>(Tas<Knots<double>>(Knots<double>(
+                                                tas.speed())),
+                                            altitude)
+          .speed());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_temperature_deviation) {
+  const Metres<double> altitude(5'000);
+  const Cas<Knots<double>> cas(Knots<double>(280));
+  const auto isa_temperature{isa::temperature(altitude)};
+
+  for (const double kelvin : {-20.0, 10.0, 35.0}) {
+    const Kelvin<double> deviation(kelvin);
+    // The Mach number and EAS only depend on the pressure.
+    BOOST_CHECK_EQUAL(convert<Mach<double>>(cas, altitude).v(),
+                      convert<Mach<double>>(cas, altitude, deviation).v());
+    BOOST_CHECK_EQUAL(
+        convert<Eas<Knots<double>>>(cas, altitude).v(),
+        convert<Eas<Knots<double>>>(cas, altitude, deviation).v());
+
+    // The TAS is proportional to the speed of sound.
+    const auto ratio{
+        std::sqrt((isa_temperature + deviation).v() / isa_temperature.v())};
+    BOOST_CHECK_CLOSE(
+        convert<Tas<Knots<double>>>(cas, altitude).v() * ratio,
+        convert<Tas<Knots<double>>>(cas, altitude, deviation).v(), 1e-12);
+  }
+
+  // At mean sea level in the ISA, CAS, EAS and TAS are the same.
+  const Metres<double> sea_level(0);
+  BOOST_CHECK_CLOSE(cas.v(), convert<Eas<Knots<double>>>(cas, sea_level).v(),
+                    1e-12);
+  BOOST_CHECK_CLOSE(cas.v(), convert<Tas<Knots<double>>>(cas, sea_level).v(),
+                    1e-12);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_float) {
+  const Feet<float> altitude(35'000);
+  const Cas<Knots<float>> cas(Knots<float>(250));
+  const auto expected{convert<Tas<Knots<double>>>(
+      Cas<Knots<double>>(Knots<double>(250)), Feet<double>(35'000))};
+  BOOST_CHECK_CLOSE(expected.v(),
+                    convert<Tas<Knots<float>>>(cas, altitude).v(), 1e-4);
+  BOOST_CHECK_CLOSE(
+      250.0f,
+      convert<Cas<Knots<float>>>(convert<Mach<float>>(cas, altitude), altitude)
+          .v(),
+      1e-4);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_batch) {
+  // more than a block of values, with a remainder of each block and lanes,
+  // up to Mach 0.85 at 40,000 ft
+  constexpr std::size_t N{1'003};
+  std::vector<Cas<Knots<double>>> cas;
+  std::vector<Feet<double>> altitudes;
+  for (std::size_t i{0}; i < N; ++i) {
+    cas.emplace_back(Knots<double>(100.0 + 0.15 * static_cast<double>(i)));
+    altitudes.emplace_back(40.0 * static_cast<double>(i));
+  }
+  const Kelvin<double> deviation(-5);
+
+  std::vector<Tas<Knots<double>>> tas(N);
+  convert<Tas<Knots<double>>, isa::Fast>(
+      std::span<const Cas<Knots<double>>>(cas),
+      std::span<const Feet<double>>(altitudes),
+      std::span<Tas<Knots<double>>>(tas), deviation);
+  for (std::size_t i{0}; i < N; ++i) {
+    const auto expected{convert<Tas<Knots<double>>, isa::Fast>(
+        cas[i], altitudes[i], deviation)};
+    BOOST_CHECK_CLOSE(expected.v(), tas[i].v(), 1e-12);
+  }
+
+  std::vector<Mach<float>> mach(N);
+  std::vector<Cas<MetresPerSecond<float>>> results(N);
+  std::vector<Metres<float>> metres;
+  for (const auto altitude : altitudes)
+    metres.emplace_back(static_cast<float>(altitude.to_metres().v()));
+  std::vector<Cas<MetresPerSecond<float>>> cas32;
+  for (const auto speed : cas)
+    cas32.emplace_back(
+        MetresPerSecond<float>(static_cast<float>(speed.speed().to_si().v())));
+  convert<Mach<float>>(std::span<const Cas<MetresPerSecond<float>>>(cas32),
+                       std::span<const Metres<float>>(metres),
+                       std::span<Mach<float>>(mach));
+  convert<Cas<MetresPerSecond<float>>>(
+      std::span<const Mach<float>>(mach),
+      std::span<const Metres<float>>(metres),
+      std::span<Cas<MetresPerSecond<float>>>(results));
+  for (std::size_t i{0}; i < N; ++i) {
+    BOOST_CHECK_CLOSE(convert<Mach<float>>(cas32[i], metres[i]).v(),
+                      mach[i].v(), 1e-4);
+    BOOST_CHECK_CLOSE(cas32[i].v(), results[i].v(), 1e-3);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_airspeed_parallel) {
+  constexpr std::size_t N{100'000};
+  std::vector<Cas<Knots<double>>> cas;
+  std::vector<Feet<double>> altitudes;
+  // up to 399 kt CAS at 50,000 ft: supersonic above 25,000 ft
+  for (std::size_t i{0}; i < N; ++i) {
+    cas.emplace_back(Knots<double>(100.0 + static_cast<double>(i % 300)));
+    altitudes.emplace_back(static_cast<double>(i % 50'000));
+  }
+
+  std::vector<Mach<double>> expected(N);
+  std::vector<Mach<double>> results(N);
+  convert<Mach<double>>(seq, std::span<const Cas<Knots<double>>>(cas),
+                        std::span<const Feet<double>>(altitudes),
+                        std::span<Mach<double>>(expected));
+  ThreadPool pool(4);
+  convert<Mach<double>>(Parallel{.threshold = 1'000, .pool = &pool},
+                        std::span<const Cas<Knots<double>>>(cas),
+                        std::span<const Feet<double>>(altitudes),
+                        std::span<Mach<double>>(results));
+  BOOST_CHECK(expected == results);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains tests for the batch conversions in batch.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/batch.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+
+namespace {
+/// Values to convert: random values with a length that exercises the SIMD
+/// tail, plus some special values.
+template <typename T> auto test_values() -> std::vector<T> {
+  std::mt19937 gen{42};
+  std::uniform_real_distribution<T> dist{T(-50'000), T(50'000)};
+  std::vector<T> values(1'027);
+  for (auto &v : values)
+    v = dist(gen);
+
+  values[0] = T();
+  values[1] = -T();
+  values[2] = std::numeric_limits<T>::max();
+  values[3] = std::numeric_limits<T>::denorm_min();
+  values[4] = std::numeric_limits<T>::infinity();
+  values[5] = std::numeric_limits<T>::quiet_NaN();
+  return values;
+}
+
+/// Compare the bit patterns of two values, so that NaNs compare equal.
+template <typename T> auto same_bits(const T a, const T b) -> bool {
+  using Bits = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+  return std::bit_cast<Bits>(a) == std::bit_cast<Bits>(b);
+}
+
+/// Test that the batch conversions from the non-SI type `N` to the SI type
+/// `S` and back are bit-for-bit identical to the scalar conversions.
+template <typename N, typename S, typename T, typename ToSi, typename FromSi,
+          typename ScalarToSi>
+void check_conversions(ToSi to_si, FromSi from_si, ScalarToSi scalar_to_si) {
+  for (const auto size : {0u, 1u, 3u, 7u, 15u, 17u, 1'027u}) {
+    const auto values{test_values<T>()};
+    std::vector<N> non_si_values;
+    std::vector<S> si_values;
+    for (std::size_t i{0}; i < size; ++i) {
+      non_si_values.emplace_back(values[i]);
+      si_values.emplace_back(values[i]);
+    }
+
+    std::vector<S> si_results(size);
+    to_si(std::span<const N>(non_si_values), std::span<S>(si_results));
+
+    std::vector<N> non_si_results(size, N(T()));
+    from_si(std::span<const S>(si_values), std::span<N>(non_si_results));
+
+    for (std::size_t i{0}; i < size; ++i) {
+      BOOST_CHECK(same_bits(scalar_to_si(non_si_values[i]).v(),
+                            si_results[i].v()));
+      BOOST_CHECK(same_bits(N(si_values[i]).v(), non_si_results[i].v()));
+    }
+  }
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_batch)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_NauticalMiles_batch_conversion) {
+  check_conversions<NauticalMiles<double>, si::Metres<double>, double>(
+      [](auto in, auto out) { to_metres(in, out); },
+      [](auto in, auto out) { to_nautical_miles(in, out); },
+      [](auto value) { return value.to_metres(); });
+  check_conversions<NauticalMiles<float>, si::Metres<float>, float>(
+      [](auto in, auto out) { to_metres(in, out); },
+      [](auto in, auto out) { to_nautical_miles(in, out); },
+      [](auto value) { return value.to_metres(); });
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_Feet_batch_conversion) {
+  check_conversions<Feet<double>, si::Metres<double>, double>(
+      [](auto in, auto out) { to_metres(in, out); },
+      [](auto in, auto out) { to_feet(in, out); },
+      [](auto value) { return value.to_metres(); });
+  check_conversions<Feet<float>, si::Metres<float>, float>(
+      [](auto in, auto out) { to_metres(in, out); },
+      [](auto in, auto out) { to_feet(in, out); },
+      [](auto value) { return value.to_metres(); });
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_Knots_batch_conversion) {
+  check_conversions<Knots<double>, si::MetresPerSecond<double>, double>(
+      [](auto in, auto out) { to_metres_per_second(in, out); },
+      [](auto in, auto out) { to_knots(in, out); },
+      [](auto value) { return value.to_metres_per_second(); });
+  check_conversions<Knots<float>, si::MetresPerSecond<float>, float>(
+      [](auto in, auto out) { to_metres_per_second(in, out); },
+      [](auto in, auto out) { to_knots(in, out); },
+      [](auto value) { return value.to_metres_per_second(); });
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_batch_convert) {
+  const auto values{test_values<double>()};
+  std::vector<Feet<double>> feet;
+  for (const auto v : values)
+    feet.emplace_back(v);
+
+  std::vector<NauticalMiles<double>> results(feet.size());
+  convert(std::span<const Feet<double>>(feet),
+          std::span<NauticalMiles<double>>(results));
+
+  for (std::size_t i{0}; i < values.size(); ++i)
+    BOOST_CHECK(same_bits(convert<NauticalMiles<double>>(feet[i]).v(),
+                          results[i].v()));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_batch_mixed_precision) {
+  const auto values{test_values<float>()};
+  for (const auto size : {0u, 1u, 3u, 7u, 15u, 17u, 1'027u}) {
+    std::vector<Feet<float>> feet;
+    for (std::size_t i{0}; i < size; ++i)
+      feet.emplace_back(values[i]);
+
+    // Float units are converted to double units without rounding to float.
+    std::vector<si::Metres<double>> metres(size);
+    convert(std::span<const Feet<float>>(feet),
+            std::span<si::Metres<double>>(metres));
+    std::vector<NauticalMiles<double>> nautical_miles(size);
+    convert(std::span<const Feet<float>>(feet),
+            std::span<NauticalMiles<double>>(nautical_miles));
+
+    for (std::size_t i{0}; i < size; ++i) {
+      const Feet<double> value(static_cast<double>(feet[i].v()));
+      BOOST_CHECK(same_bits(value.to_metres().v(), metres[i].v()));
+      BOOST_CHECK(same_bits(convert<NauticalMiles<double>>(value).v(),
+                            nautical_miles[i].v()));
+    }
+  }
+
+  // The sum of float units is accumulated in double.
+  const std::vector<si::Metres<float>> distances(1'000'003,
+                                                 si::Metres<float>(0.1f));
+  const auto total{sum(std::span<const si::Metres<float>>(distances))};
+  BOOST_CHECK_CLOSE(1'000'003 * static_cast<double>(0.1f), total.v(), 1e-9);
+
+  const std::vector<Feet<double>> altitudes{Feet<double>(1), Feet<double>(2),
+                                            Feet<double>(3)};
+  BOOST_CHECK_EQUAL(Feet<double>(6),
+                    sum(std::span<const Feet<double>>(altitudes)));
+  BOOST_CHECK_EQUAL(0.0, simd::sum(std::span<const float>()));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_batch_integer) {
+  for (const auto size : {0u, 1u, 3u, 7u, 15u, 17u, 1'027u}) {
+    std::vector<FlightLevels<std::int16_t>> levels;
+    std::vector<Feet<std::int32_t>> feet;
+    for (std::size_t i{0}; i < size; ++i) {
+      const auto value{static_cast<int>(i * 37 % 1'000) - 500};
+      levels.emplace_back(static_cast<std::int16_t>(value));
+      feet.emplace_back(value * 100'001);
+    }
+    if (size > 2) {
+      levels[0] = FlightLevels<std::int16_t>(INT16_MIN);
+      levels[1] = FlightLevels<std::int16_t>(INT16_MAX);
+      feet[0] = Feet<std::int32_t>(INT32_MIN);
+      feet[1] = Feet<std::int32_t>(INT32_MAX);
+    }
+
+    // Integer units are widened to float and double units.
+    std::vector<si::Metres<float>> metres32(size);
+    convert(std::span<const FlightLevels<std::int16_t>>(levels),
+            std::span<si::Metres<float>>(metres32));
+    std::vector<Feet<double>> feet64(size);
+    convert(std::span<const FlightLevels<std::int16_t>>(levels),
+            std::span<Feet<double>>(feet64));
+    std::vector<Feet<float>> feet32(size);
+    convert(std::span<const Feet<std::int32_t>>(feet),
+            std::span<Feet<float>>(feet32));
+    std::vector<si::Metres<double>> metres64(size);
+    convert(seq, std::span<const Feet<std::int32_t>>(feet),
+            std::span<si::Metres<double>>(metres64));
+
+    for (std::size_t i{0}; i < size; ++i) {
+      BOOST_CHECK(same_bits(convert<si::Metres<float>>(levels[i]).v(),
+                            metres32[i].v()));
+      BOOST_CHECK(
+          same_bits(convert<Feet<double>>(levels[i]).v(), feet64[i].v()));
+      BOOST_CHECK(
+          same_bits(convert<Feet<float>>(feet[i]).v(), feet32[i].v()));
+      BOOST_CHECK(same_bits(convert<si::Metres<double>>(feet[i]).v(),
+                            metres64[i].v()));
+    }
+  }
+
+  // The sum of integer units is accumulated in double.
+  const std::vector<FlightLevels<std::int16_t>> levels(
+      100'003, FlightLevels<std::int16_t>(INT16_MAX));
+  BOOST_CHECK_EQUAL(
+      100'003.0 * INT16_MAX,
+      sum(std::span<const FlightLevels<std::int16_t>>(levels)).v());
+  const std::vector<Feet<std::int32_t>> altitudes{
+      Feet<std::int32_t>(1), Feet<std::int32_t>(-2), Feet<std::int32_t>(3)};
+  BOOST_CHECK_EQUAL(Feet<double>(2),
+                    sum(std::span<const Feet<std::int32_t>>(altitudes)));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_batch_parallel) {
+  // Enough values for several chunks, with a partial last chunk.
+  const auto values{test_values<double>()};
+  std::vector<Feet<double>> feet;
+  for (std::size_t i{0}; i < 100'003; ++i)
+    feet.emplace_back(values[i % values.size()]);
+  const std::span<const Feet<double>> in(feet);
+
+  ThreadPool pool(4);
+  BOOST_CHECK_EQUAL(4u, pool.size());
+  const Parallel policy{.threshold = 1'000, .pool = &pool};
+
+  // The results are bit-for-bit identical to the sequenced results.
+  std::vector<si::Metres<double>> expected(feet.size());
+  std::vector<si::Metres<double>> metres(feet.size());
+  to_metres(in, std::span<si::Metres<double>>(expected));
+  to_metres(policy, in, std::span<si::Metres<double>>(metres));
+  for (std::size_t i{0}; i < feet.size(); ++i)
+    BOOST_CHECK(same_bits(expected[i].v(), metres[i].v()));
+
+  std::vector<NauticalMiles<double>> nautical_miles(feet.size());
+  convert(par, in, std::span<NauticalMiles<double>>(nautical_miles));
+  for (std::size_t i{0}; i < feet.size(); ++i)
+    BOOST_CHECK(same_bits(convert<NauticalMiles<double>>(feet[i]).v(),
+                          nautical_miles[i].v()));
+
+  std::vector<Feet<double>> round_trip(feet.size());
+  to_feet(seq, std::span<const si::Metres<double>>(metres),
+          std::span<Feet<double>>(round_trip));
+  for (std::size_t i{0}; i < feet.size(); ++i)
+    BOOST_CHECK(same_bits(Feet<double>(metres[i]).v(), round_trip[i].v()));
+
+  // The sum does not depend on the number of threads.
+  const std::vector<si::Metres<float>> distances(1'000'003,
+                                                 si::Metres<float>(0.1f));
+  const std::span<const si::Metres<float>> distances_span(distances);
+  ThreadPool single(1);
+  const auto total{sum(policy, distances_span)};
+  BOOST_CHECK_EQUAL(total, sum(Parallel{.threshold = 1'000, .pool = &single},
+                               distances_span));
+  BOOST_CHECK_CLOSE(sum(distances_span).v(), total.v(), 1e-9);
+  BOOST_CHECK_EQUAL(sum(distances_span), sum(seq, distances_span));
+
+  // Every chunk is run once, including by nested loops.
+  std::vector<std::atomic<int>> counts(1'000);
+  pool.for_each(counts.size(), [&](const std::size_t chunk) {
+    counts[chunk].fetch_add(1);
+    if (chunk == 0)
+      pool.for_each(2, [&](const std::size_t) { counts[1].fetch_add(1); });
+  });
+  BOOST_CHECK_EQUAL(3, counts[1].load());
+  counts[1] = 1;
+  BOOST_CHECK(std::ranges::all_of(counts, [](const auto &count) {
+    return count.load() == 1;
+  }));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_simd_in_place) {
+  const auto values{test_values<double>()};
+  std::vector<double> results(values);
+  const std::span<double> span(results);
+  simd::multiply(std::span<const double>(span), METRES_PER_FOOT<double>, span);
+  simd::divide(std::span<const double>(span), METRES_PER_FOOT<double>, span);
+
+  for (std::size_t i{0}; i < values.size(); ++i)
+    BOOST_CHECK(same_bits((values[i] * METRES_PER_FOOT<double>) /
+                              METRES_PER_FOOT<double>,
+                          results[i]));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,211 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains tests for the codec in codec.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/codec.hpp"
+#include "via/units/non_si.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+
+namespace {
+/// A climb from 1'000 ft to FL350 and a cruise, with turbulence.
+auto climb(const std::size_t size) -> std::vector<Feet<double>> {
+  std::vector<Feet<double>> altitudes;
+  for (std::size_t i{0}; i < size; ++i)
+    altitudes.emplace_back(std::min(1'000.0 + 25.3 * i, 35'000.0) +
+                           7.0 * std::sin(0.37 * i));
+  return altitudes;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(Test_codec)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_codec_round_trip) {
+  const auto altitudes{climb(1'000)};
+  std::vector<std::byte> bytes;
+  BOOST_CHECK(std::errc() == encode(altitudes, Feet<double>(1), bytes));
+  // Less than 1 byte per value, instead of 8.
+  BOOST_CHECK_LT(bytes.size(), altitudes.size());
+
+  const std::span<const std::byte> encoded(bytes);
+  BOOST_CHECK_EQUAL(altitudes.size(), *decoded_size<Feet<double>>(encoded));
+  std::vector<Feet<double>> decoded(altitudes.size());
+  const auto size{decode(encoded, std::span<Feet<double>>(decoded))};
+  BOOST_CHECK_EQUAL(bytes.size(), *size);
+  for (std::size_t i{0}; i < altitudes.size(); ++i) {
+    BOOST_CHECK_EQUAL(std::round(altitudes[i].v()), decoded[i].v());
+    BOOST_CHECK_LE(std::abs(altitudes[i].v() - decoded[i].v()), 0.5);
+  }
+
+  // The value type is not recorded, so the series may be decoded as floats.
+  std::vector<Feet<float>> floats(altitudes.size());
+  BOOST_CHECK_EQUAL(bytes.size(),
+                    *decode(encoded, std::span<Feet<float>>(floats)));
+  BOOST_CHECK_EQUAL(static_cast<float>(decoded[500].v()), floats[500].v());
+
+  // A fractional quantum.
+  std::vector<Knots<float>> speeds;
+  for (int i{0}; i < 300; ++i)
+    speeds.emplace_back(250.0f + 0.37f * static_cast<float>(i));
+  bytes.clear();
+  BOOST_CHECK(std::errc() == encode(speeds, Knots<float>(0.1f), bytes));
+  std::vector<Knots<float>> decoded_speeds(speeds.size());
+  BOOST_CHECK(decode(std::span<const std::byte>(bytes),
+                     std::span<Knots<float>>(decoded_speeds)));
+  for (std::size_t i{0}; i < speeds.size(); ++i)
+    BOOST_CHECK_LE(std::abs(speeds[i].v() - decoded_speeds[i].v()), 0.0501f);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_codec_sizes) {
+  std::vector<std::byte> bytes;
+  const std::vector<NauticalMiles<double>> empty;
+  BOOST_CHECK(std::errc() == encode(empty, NauticalMiles<double>(0.01), bytes));
+  BOOST_CHECK_EQUAL(sizeof(EncodedHeader), bytes.size());
+  BOOST_CHECK_EQUAL(0u, *decoded_size<NauticalMiles<double>>(bytes));
+  BOOST_CHECK_EQUAL(sizeof(EncodedHeader),
+                    *decode(std::span<const std::byte>(bytes),
+                            std::span<NauticalMiles<double>>()));
+
+  // A constant series has blocks of zero width.
+  const std::vector<NauticalMiles<double>> constant(
+      2 * CODEC_BLOCK_SIZE + 2, NauticalMiles<double>(12.5));
+  bytes.clear();
+  BOOST_CHECK(std::errc() ==
+              encode(constant, NauticalMiles<double>(0.01), bytes));
+  BOOST_CHECK_EQUAL(sizeof(EncodedHeader) + 3, bytes.size());
+  std::vector<NauticalMiles<double>> decoded(constant.size());
+  BOOST_CHECK(decode(std::span<const std::byte>(bytes),
+                     std::span<NauticalMiles<double>>(decoded)));
+  BOOST_CHECK(decoded == constant);
+
+  // The largest differences have 64 bits.
+  const double large{0x1p61};
+  const std::vector<Feet<double>> extremes{
+      Feet<double>(-large), Feet<double>(large), Feet<double>(-large),
+      Feet<double>(large / 2), Feet<double>(0)};
+  bytes.clear();
+  BOOST_CHECK(std::errc() == encode(extremes, Feet<double>(1), bytes));
+  BOOST_CHECK_EQUAL(64u,
+                    std::to_integer<unsigned>(bytes[sizeof(EncodedHeader)]));
+  std::vector<Feet<double>> decoded_extremes(extremes.size());
+  BOOST_CHECK(decode(std::span<const std::byte>(bytes),
+                     std::span<Feet<double>>(decoded_extremes)));
+  BOOST_CHECK(decoded_extremes == extremes);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_codec_concatenated) {
+  // Series may be appended to the same bytes and decoded in turn.
+  const auto altitudes{climb(200)};
+  const std::vector<Knots<double>> speeds(10, Knots<double>(250));
+  std::vector<std::byte> bytes;
+  BOOST_CHECK(std::errc() == encode(altitudes, Feet<double>(10), bytes));
+  BOOST_CHECK(std::errc() == encode(speeds, Knots<double>(1), bytes));
+
+  std::span<const std::byte> encoded(bytes);
+  std::vector<Feet<double>> decoded_altitudes(altitudes.size());
+  const auto size{
+      decode(encoded, std::span<Feet<double>>(decoded_altitudes))};
+  BOOST_REQUIRE(size);
+  BOOST_CHECK_EQUAL(10.0 * std::round(altitudes[120].v() / 10.0),
+                    decoded_altitudes[120].v());
+
+  encoded = encoded.subspan(*size);
+  std::vector<Knots<double>> decoded_speeds(speeds.size());
+  BOOST_CHECK_EQUAL(encoded.size(),
+                    *decode(encoded, std::span<Knots<double>>(decoded_speeds)));
+  BOOST_CHECK(decoded_speeds == speeds);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_codec_errors) {
+  const auto altitudes{climb(300)};
+  std::vector<std::byte> bytes{std::byte{42}};
+
+  // Invalid quanta and values do not change the bytes.
+  BOOST_CHECK(std::errc::invalid_argument ==
+              encode(altitudes, Feet<double>(0), bytes));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              encode(altitudes, Feet<double>(-1), bytes));
+  auto invalid{altitudes};
+  invalid[200] = Feet<double>(std::numeric_limits<double>::quiet_NaN());
+  BOOST_CHECK(std::errc::invalid_argument ==
+              encode(invalid, Feet<double>(1), bytes));
+  invalid[200] = Feet<double>(0x1p62);
+  BOOST_CHECK(std::errc::invalid_argument ==
+              encode(invalid, Feet<double>(1), bytes));
+  BOOST_CHECK_EQUAL(1u, bytes.size());
+
+  bytes.clear();
+  BOOST_CHECK(std::errc() == encode(altitudes, Feet<double>(1), bytes));
+  const std::span<const std::byte> encoded(bytes);
+  std::vector<Feet<double>> decoded(altitudes.size());
+  const std::span<Feet<double>> out(decoded);
+
+  // The wrong unit or too few units.
+  BOOST_CHECK(std::errc::invalid_argument ==
+              decoded_size<si::Metres<double>>(encoded).error());
+  BOOST_CHECK(std::errc::invalid_argument ==
+              decode(encoded, out.first(299)).error());
+
+  // Truncated series.
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(encoded.first(sizeof(EncodedHeader) - 1), out).error());
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(encoded.first(sizeof(EncodedHeader)), out).error());
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(encoded.first(bytes.size() - 1), out).error());
+
+  // A corrupt signature, version, quantum or width.
+  auto corrupt{bytes};
+  corrupt[0] = std::byte{'X'};
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(std::span<const std::byte>(corrupt), out).error());
+  corrupt = bytes;
+  corrupt[4] = std::byte{CODEC_VERSION + 1};
+  BOOST_CHECK(std::errc::not_supported ==
+              decode(std::span<const std::byte>(corrupt), out).error());
+  corrupt = bytes;
+  const double quantum{std::numeric_limits<double>::infinity()};
+  std::memcpy(corrupt.data() + offsetof(EncodedHeader, quantum), &quantum,
+              sizeof(quantum));
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(std::span<const std::byte>(corrupt), out).error());
+  corrupt = bytes;
+  corrupt[sizeof(EncodedHeader)] = std::byte{65};
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              decode(std::span<const std::byte>(corrupt), out).error());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
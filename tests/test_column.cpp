@@ -0,0 +1,237 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @file
+/// @brief Contains tests for the unit columns and tables in column.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/batch.hpp"
+#include "via/units/column.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+
+namespace {
+/// Whether the pointer is aligned to COLUMN_ALIGNMENT.
+auto is_aligned(const void *p) -> bool {
+  return reinterpret_cast<std::uintptr_t>(p) % COLUMN_ALIGNMENT == 0;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_column)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitColumn) {
+  UnitColumn<Feet<double>> column;
+  BOOST_CHECK(column.empty());
+  BOOST_CHECK_EQUAL(0u, column.capacity());
+  BOOST_CHECK(std::pmr::get_default_resource() == column.resource());
+
+  for (int i{0}; i < 100; ++i) {
+    column.push_back(Feet<double>(i));
+    BOOST_CHECK(is_aligned(column.data()));
+  }
+  BOOST_CHECK_EQUAL(100u, column.size());
+  BOOST_CHECK_LE(100u, column.capacity());
+  BOOST_CHECK_EQUAL(Feet<double>(42), column[42]);
+
+  // The values are the values of the units
+  BOOST_CHECK_EQUAL(99.0, column.values()[99]);
+  column.values()[0] = 1000.0;
+  BOOST_CHECK_EQUAL(Feet<double>(1000), column.units()[0]);
+
+  // The batch conversions accept the spans of the units
+  UnitColumn<si::Metres<double>> metres(column.size());
+  BOOST_CHECK_EQUAL(100u, metres.size());
+  BOOST_CHECK(is_aligned(metres.data()));
+  to_metres(std::span<const Feet<double>>(column.units()), metres.units());
+  BOOST_CHECK_EQUAL(column[42].to_metres(), metres[42]);
+
+  const auto capacity{column.capacity()};
+  column.clear();
+  BOOST_CHECK(column.empty());
+  BOOST_CHECK_EQUAL(capacity, column.capacity());
+  BOOST_CHECK(column.begin() == column.end());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitColumn_integer) {
+  // Two byte flight levels are widened to Metres for calculations.
+  UnitColumn<FlightLevels<std::int16_t>> levels;
+  for (int i{0}; i < 100; ++i)
+    levels.push_back(
+        FlightLevels<std::int16_t>(static_cast<std::int16_t>(i * 5)));
+  BOOST_CHECK(is_aligned(levels.data()));
+  BOOST_CHECK_EQUAL(std::int16_t{495}, levels.values()[99]);
+
+  UnitColumn<si::Metres<float>> metres(levels.size());
+  convert(std::span<const FlightLevels<std::int16_t>>(levels.units()),
+          metres.units());
+  BOOST_CHECK_EQUAL(convert<si::Metres<float>>(levels[42]), metres[42]);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitColumn_assign) {
+  UnitColumn<Knots<double>> column;
+  for (int i{0}; i < 10; ++i)
+    column.push_back(Knots<double>(i));
+
+  // The units may be assigned from the column itself
+  column.assign(column.units().subspan(1));
+  BOOST_CHECK_EQUAL(9u, column.size());
+  for (std::size_t i{0}; i < column.size(); ++i)
+    BOOST_CHECK_EQUAL(Knots<double>(i + 1), column[i]);
+
+  column.assign(column.units().first(4));
+  BOOST_CHECK_EQUAL(4u, column.size());
+  BOOST_CHECK_EQUAL(Knots<double>(4), column[3]);
+
+  const std::vector<Knots<double>> knots(100, Knots<double>(250));
+  column.assign(knots);
+  BOOST_CHECK_EQUAL(100u, column.size());
+  BOOST_CHECK(std::ranges::equal(knots, column));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitColumn_copy_and_move) {
+  alignas(COLUMN_ALIGNMENT) std::array<std::byte, 4'096> buffer;
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+
+  const std::array<si::Kelvin<float>, 3> temperatures{
+      si::Kelvin<float>(288.15f), si::Kelvin<float>(250.0f),
+      si::Kelvin<float>(216.65f)};
+  UnitColumn<si::Kelvin<float>> column(temperatures, &arena);
+  BOOST_CHECK(&arena == column.resource());
+  BOOST_CHECK(is_aligned(column.data()));
+  BOOST_CHECK_EQUAL(3u, column.size());
+  BOOST_CHECK_EQUAL(si::Kelvin<float>(250.0f), column[1]);
+
+  // A copy uses the default memory resource, like the std::pmr containers
+  UnitColumn<si::Kelvin<float>> copy(column);
+  BOOST_CHECK(std::pmr::get_default_resource() == copy.resource());
+  BOOST_CHECK(std::ranges::equal(column, copy));
+
+  UnitColumn<si::Kelvin<float>> arena_copy(copy, &arena);
+  BOOST_CHECK(&arena == arena_copy.resource());
+  BOOST_CHECK(std::ranges::equal(column, arena_copy));
+
+  // A move takes the storage
+  const auto *data{column.data()};
+  UnitColumn<si::Kelvin<float>> moved(std::move(column));
+  BOOST_CHECK(&arena == moved.resource());
+  BOOST_CHECK(data == moved.data());
+  BOOST_CHECK(column.empty());
+
+  // Assignment keeps the memory resource
+  copy = moved;
+  BOOST_CHECK(std::pmr::get_default_resource() == copy.resource());
+  BOOST_CHECK(std::ranges::equal(moved, copy));
+  copy = std::move(arena_copy);
+  BOOST_CHECK(std::pmr::get_default_resource() == copy.resource());
+  BOOST_CHECK(std::ranges::equal(moved, copy));
+  moved = std::move(copy);
+  BOOST_CHECK(&arena == moved.resource());
+  BOOST_CHECK_EQUAL(3u, moved.size());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitTable) {
+  // All of the columns are allocated from the arena
+  std::vector<std::byte> buffer(256 * 1'024);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+
+  UnitTable<si::Metres<double>, Knots<double>, si::Kelvin<double>,
+            si::Metres<double>>
+      table(&arena);
+  static_assert(4u == decltype(table)::COLUMNS);
+  BOOST_CHECK(&arena == table.resource());
+  BOOST_CHECK(table.empty());
+
+  table.reserve(10);
+  for (int i{0}; i < 1'000; ++i)
+    table.push_back(si::Metres<double>(i), Knots<double>(2 * i),
+                    si::Kelvin<double>(288.15), si::Metres<double>(-i));
+  BOOST_CHECK_EQUAL(1'000u, table.size());
+  BOOST_CHECK_EQUAL(Knots<double>(200), table.column<1>()[100]);
+  BOOST_CHECK_EQUAL(Knots<double>(200), table.column<Knots<double>>()[100]);
+  BOOST_CHECK_EQUAL(si::Kelvin<double>(288.15),
+                    table.column<si::Kelvin<double>>()[999]);
+  BOOST_CHECK_EQUAL(si::Metres<double>(-5), table.column<3>()[5]);
+  BOOST_CHECK(is_aligned(table.column<2>().data()));
+  BOOST_CHECK(&arena == table.column<2>().resource());
+
+  table.resize_for_overwrite(2'000);
+  BOOST_CHECK_EQUAL(2'000u, table.size());
+  BOOST_CHECK_EQUAL(2'000u, table.column<0>().size());
+  BOOST_CHECK_EQUAL(si::Metres<double>(999), table.column<0>()[999]);
+
+  table.clear();
+  BOOST_CHECK(table.empty());
+
+  const UnitTable<Feet<float>, NauticalMiles<float>> sized(5);
+  BOOST_CHECK_EQUAL(5u, sized.size());
+  BOOST_CHECK_EQUAL(5u, sized.column<NauticalMiles<float>>().size());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_UnitTable_allocation_failure) {
+  // An arena that cannot grow, so that push_back eventually fails
+  std::vector<std::byte> buffer(4'096);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                            std::pmr::null_memory_resource());
+
+  // A failed push_back leaves every column with the same rows
+  UnitTable<Feet<float>, si::Metres<double>> table(&arena);
+  std::size_t rows{0};
+  BOOST_CHECK_THROW(
+      for (;; ++rows) table.push_back(Feet<float>(static_cast<float>(rows)),
+                                      si::Metres<double>(-1.0 * rows)),
+      std::bad_alloc);
+  BOOST_CHECK_LT(0u, rows);
+  BOOST_CHECK_EQUAL(rows, table.size());
+  BOOST_CHECK_EQUAL(rows, table.column<1>().size());
+  BOOST_CHECK_EQUAL(si::Metres<double>(1.0 - rows),
+                    table.column<1>()[rows - 1]);
+
+  // A failed resize_for_overwrite leaves the table unchanged
+  BOOST_CHECK_THROW(table.resize_for_overwrite(10'000), std::bad_alloc);
+  BOOST_CHECK_EQUAL(rows, table.size());
+  BOOST_CHECK_EQUAL(rows, table.column<1>().size());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
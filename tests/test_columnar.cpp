@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @file
+/// @brief Contains tests for the columnar file format in columnar.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/columnar.hpp"
+#include "via/units/non_si.hpp"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+
+namespace {
+/// A columnar file in the temporary directory, removed by the destructor.
+struct TemporaryFile {
+  std::filesystem::path path;
+
+  explicit TemporaryFile(const char *name)
+      : path{std::filesystem::temp_directory_path() / name} {}
+  ~TemporaryFile() { std::filesystem::remove(path); }
+};
+
+/// The test columns.
+struct Columns {
+  std::vector<Feet<double>> altitudes;
+  std::vector<Knots<double>> speeds;
+  std::vector<si::Kelvin<float>> temperatures;
+
+  explicit Columns(const std::size_t size) {
+    for (std::size_t i{0}; i < size; ++i) {
+      altitudes.emplace_back(100.0 * i);
+      speeds.emplace_back(250.0 + i);
+      temperatures.emplace_back(288.15f - 0.5f * i);
+    }
+  }
+
+  auto write(const std::filesystem::path &path) const -> std::errc {
+    return write_columns(
+        path, NamedColumn<Feet<double>>{"altitude", altitudes},
+        NamedColumn<Knots<double>>{"speed", speeds},
+        NamedColumn<si::Kelvin<float>>{"temperature", temperatures});
+  }
+};
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_columnar)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_columnar_file) {
+  const TemporaryFile file("via_units_test_columnar_file.bin");
+  for (const std::size_t size : {0u, 1u, 17u, 1'000u}) {
+    const Columns columns(size);
+    BOOST_REQUIRE(std::errc() == columns.write(file.path));
+
+    const auto mapped{MappedColumns<Feet<double>, Knots<double>,
+                                    si::Kelvin<float>>::open(file.path)};
+    BOOST_REQUIRE(mapped);
+    BOOST_CHECK_EQUAL(size, mapped->size());
+    BOOST_CHECK_EQUAL("altitude", mapped->name<0>());
+    BOOST_CHECK_EQUAL("speed", mapped->name<1>());
+    BOOST_CHECK_EQUAL("temperature", mapped->name<2>());
+
+    const auto altitudes{mapped->column<0>()};
+    BOOST_CHECK_EQUAL(size, altitudes.size());
+    BOOST_CHECK(std::ranges::equal(columns.altitudes, altitudes));
+    BOOST_CHECK(std::ranges::equal(columns.speeds,
+                                   mapped->column<Knots<double>>()));
+    BOOST_CHECK(std::ranges::equal(columns.temperatures,
+                                   mapped->column<si::Kelvin<float>>()));
+    BOOST_CHECK_EQUAL(0u, reinterpret_cast<std::uintptr_t>(
+                              mapped->column<2>().data()) %
+                              COLUMNAR_ALIGNMENT);
+  }
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_columnar_file_errors) {
+  const TemporaryFile file("via_units_test_columnar_file_errors.bin");
+  const Columns columns(10);
+  BOOST_REQUIRE(std::errc() == columns.write(file.path));
+
+  // The units must match the units of the columns
+  using Expected =
+      MappedColumns<Feet<double>, Knots<double>, si::Kelvin<float>>;
+  BOOST_CHECK(Expected::open(file.path));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              (MappedColumns<si::Metres<double>, Knots<double>,
+                             si::Kelvin<float>>::open(file.path)
+                   .error()));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              (MappedColumns<Feet<double>, Knots<double>,
+                             si::Kelvin<double>>::open(file.path)
+                   .error()));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              (MappedColumns<Feet<double>, Knots<double>>::open(file.path)
+                   .error()));
+
+  // The columns must be the same size and the names must fit
+  const std::vector<Feet<double>> short_column(5, Feet<double>(1));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              write_columns(file.path,
+                            NamedColumn<Feet<double>>{"a", columns.altitudes},
+                            NamedColumn<Feet<double>>{"b", short_column}));
+  BOOST_CHECK(std::errc::invalid_argument ==
+              write_columns(file.path,
+                            NamedColumn<Feet<double>>{
+                                "a_very_long_column_name_of_altitudes",
+                                columns.altitudes}));
+
+  BOOST_CHECK(std::errc::no_such_file_or_directory ==
+              Expected::open(file.path.string() + ".missing").error());
+
+  // Truncated and corrupt files are rejected
+  const auto size{std::filesystem::file_size(file.path)};
+  std::filesystem::resize_file(file.path, size - COLUMNAR_ALIGNMENT);
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              Expected::open(file.path).error());
+  std::filesystem::resize_file(file.path, 0);
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              Expected::open(file.path).error());
+
+  BOOST_REQUIRE(std::errc() == columns.write(file.path));
+  {
+    std::fstream stream(file.path,
+                        std::ios::binary | std::ios::in | std::ios::out);
+    stream.write("XYZ", 3);
+  }
+  BOOST_CHECK(std::errc::illegal_byte_sequence ==
+              Expected::open(file.path).error());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_columnar_file_version) {
+  const TemporaryFile file("via_units_test_columnar_file_version.bin");
+  const Columns columns(3);
+  BOOST_REQUIRE(std::errc() == columns.write(file.path));
+  {
+    std::fstream stream(file.path,
+                        std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(offsetof(ColumnarFileHeader, version));
+    const std::uint32_t version{COLUMNAR_VERSION + 1};
+    stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+  }
+  BOOST_CHECK(
+      std::errc::not_supported ==
+      (MappedColumns<Feet<double>, Knots<double>, si::Kelvin<float>>::open(
+           file.path)
+           .error()));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
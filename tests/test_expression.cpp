@@ -0,0 +1,210 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+/// @file
+/// @brief Contains tests for the expressions in expression.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/expression.hpp"
+#include "via/units/non_si.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+using namespace via::units::si;
+
+namespace {
+/// Whether a and b can be added.
+template <typename A, typename B>
+concept Addable = requires(A a, B b) { a + b; };
+
+/// The element type of the expression of a and b.
+template <typename X> using element_t = typename X::element_type;
+
+using MetresSpan = std::span<const Metres<double>>;
+using FeetSpan = std::span<const Feet<double>>;
+using SecondsSpan = std::span<const Seconds<double>>;
+using MetresExpression = expression::Span<Metres<double>>;
+} // namespace
+
+// The element types are checked by the operators of the elements.
+static_assert(std::is_same_v<Metres<double>,
+                             element_t<decltype(lazy(MetresSpan()) +
+                                                lazy(MetresSpan()))>>);
+static_assert(std::is_same_v<MetresPerSecond<double>,
+                             element_t<decltype(lazy(MetresSpan()) /
+                                                lazy(SecondsSpan()))>>);
+static_assert(std::is_same_v<double, element_t<decltype(lazy(MetresSpan()) /
+                                                       lazy(MetresSpan()))>>);
+static_assert(std::is_same_v<Metres<double>,
+                             element_t<decltype(-lazy(MetresSpan()) * 2.0 +
+                                                Metres<double>(1))>>);
+static_assert(Addable<MetresExpression, MetresExpression> &&
+              Addable<MetresExpression, Metres<double>>);
+static_assert(!Addable<MetresExpression, expression::Span<Feet<double>>> &&
+              !Addable<MetresExpression, Feet<double>> &&
+              !Addable<MetresExpression, double> &&
+              !Addable<MetresExpression, expression::Span<Metres<float>>>);
+static_assert(!Addable<Metres<double>, double>);
+
+namespace {
+/// Whether a and b have the same bit pattern.
+template <typename T> auto same_bits(const T a, const T b) -> bool {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/// Random units, uniformly distributed in [low, high).
+template <typename U>
+auto random_units(const std::size_t size, const unit_value_t<U> low,
+                  const unit_value_t<U> high, const unsigned seed)
+    -> std::vector<U> {
+  std::mt19937 gen{seed};
+  std::uniform_real_distribution<unit_value_t<U>> dist{low, high};
+  std::vector<U> units;
+  for (std::size_t i{0}; i < size; ++i)
+    units.emplace_back(dist(gen));
+  return units;
+}
+
+// Enough elements for the SIMD lanes and a scalar tail.
+constexpr std::size_t SIZE{1'003};
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_expression)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_evaluate) {
+  const auto a{random_units<Metres<double>>(SIZE, -1'000, 1'000, 1)};
+  const auto b{random_units<Metres<double>>(SIZE, -1'000, 1'000, 2)};
+  const auto c{random_units<Metres<double>>(SIZE, -1'000, 1'000, 3)};
+  const auto t{random_units<Seconds<double>>(SIZE, 1, 100, 4)};
+
+  // The results are bit-for-bit identical to the scalar expressions.
+  const auto x{lazy(a) + lazy(b) - lazy(c)};
+  BOOST_CHECK_EQUAL(SIZE, x.size());
+  std::vector<Metres<double>> metres(SIZE);
+  evaluate(x, std::span<Metres<double>>(metres));
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits((a[i] + b[i] - c[i]).v(), metres[i].v()));
+
+  evaluate(-lazy(a) * 2.0 + Metres<double>(10) - lazy(c) / 4.0, metres);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits((-a[i] * 2.0 + Metres<double>(10) - c[i] / 4.0).v(),
+                          metres[i].v()));
+
+  std::vector<MetresPerSecond<double>> speeds(SIZE);
+  evaluate((lazy(a) - lazy(b)) / lazy(t), speeds);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits(((a[i] - b[i]) / t[i]).v(), speeds[i].v()));
+
+  // Dimensionless ratios are values.
+  std::vector<double> ratios(SIZE);
+  evaluate(lazy(a) / lazy(b), ratios);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits(a[i] / b[i], ratios[i]));
+
+  // The negation of values is identical to their unary minus.
+  std::vector<double> negated(SIZE);
+  const std::vector<double> zeros{0.0, -0.0};
+  evaluate(-lazy(zeros), negated);
+  BOOST_CHECK(same_bits(-0.0, negated[0]));
+  BOOST_CHECK(same_bits(0.0, negated[1]));
+
+  // The output may be one of the inputs.
+  auto d{a};
+  evaluate(lazy(d) * 0.5 + lazy(b), d);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits((a[i] * 0.5 + b[i]).v(), d[i].v()));
+
+  // An empty expression.
+  const std::vector<Metres<double>> empty;
+  evaluate(lazy(empty) + lazy(empty), std::span<Metres<double>>());
+  BOOST_CHECK_EQUAL(0u, (lazy(empty) + lazy(empty)).size());
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_evaluate_float) {
+  const auto fuel{random_units<Kilograms<float>>(SIZE, 0, 100'000, 1)};
+  const auto burn{random_units<Kilograms<float>>(SIZE, 0, 10'000, 2)};
+  const auto empty{random_units<Kilograms<float>>(SIZE, 40'000, 60'000, 3)};
+
+  // A mass balance: the mass after burning some fuel, with 5% reserve.
+  std::vector<Kilograms<float>> mass(SIZE);
+  evaluate(lazy(empty) + lazy(fuel) - lazy(burn) * 1.05f, mass);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(
+        same_bits((empty[i] + fuel[i] - burn[i] * 1.05f).v(), mass[i].v()));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_evaluate_column) {
+  const auto a{random_units<Metres<double>>(SIZE, -1'000, 1'000, 1)};
+  const UnitColumn<Metres<double>> b(
+      random_units<Metres<double>>(SIZE, -1'000, 1'000, 2));
+
+  // The column is resized to the size of the expression.
+  UnitColumn<Metres<double>> sum;
+  evaluate(lazy(a) + lazy(b), sum);
+  BOOST_REQUIRE_EQUAL(SIZE, sum.size());
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits((a[i] + b[i]).v(), sum[i].v()));
+
+  evaluate(seq, lazy(sum) - lazy(b), sum);
+  BOOST_REQUIRE_EQUAL(SIZE, sum.size());
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits((a[i] + b[i] - b[i]).v(), sum[i].v()));
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_evaluate_parallel) {
+  // Enough elements for several chunks, with a partial last chunk.
+  constexpr std::size_t LARGE_SIZE{100'003};
+  const auto a{random_units<Metres<double>>(LARGE_SIZE, -1'000, 1'000, 1)};
+  const auto b{random_units<Metres<double>>(LARGE_SIZE, -1'000, 1'000, 2)};
+  const auto t{random_units<Seconds<double>>(LARGE_SIZE, 1, 100, 3)};
+
+  ThreadPool pool(4);
+  const Parallel policy{.threshold = 1'000, .pool = &pool};
+  const auto x{(lazy(a) - lazy(b)) / lazy(t)};
+
+  // The results are bit-for-bit identical to the sequenced results.
+  std::vector<MetresPerSecond<double>> expected(LARGE_SIZE);
+  std::vector<MetresPerSecond<double>> speeds(LARGE_SIZE);
+  evaluate(x, expected);
+  evaluate(policy, x, speeds);
+  for (std::size_t i{0}; i < LARGE_SIZE; ++i)
+    BOOST_CHECK(same_bits(expected[i].v(), speeds[i].v()));
+
+  UnitColumn<MetresPerSecond<double>> column;
+  evaluate(par, x, column);
+  BOOST_REQUIRE_EQUAL(LARGE_SIZE, column.size());
+  for (std::size_t i{0}; i < LARGE_SIZE; ++i)
+    BOOST_CHECK(same_bits(expected[i].v(), column[i].v()));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
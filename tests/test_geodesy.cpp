@@ -0,0 +1,222 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+/// @file
+/// @brief Contains tests for the distances and bearings in geodesy.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/geodesy.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::geodesy;
+using namespace via::units::non_si;
+using namespace via::units::si;
+
+namespace {
+/// London Heathrow and New York JFK airports.
+constexpr LatLong<double> EGLL{51.4775, -0.461389};
+constexpr LatLong<double> KJFK{40.639722, -73.778889};
+
+/// The great circle distance by the haversine formula with `std::asin` in
+/// long double.
+auto reference_distance(const LatLong<double> a, const LatLong<double> b)
+    -> long double {
+  constexpr long double k{std::numbers::pi_v<long double> / 180};
+  const long double phi1{a.latitude * k};
+  const long double phi2{b.latitude * k};
+  const long double s1{std::sin((b.latitude - a.latitude) * k / 2)};
+  const long double s2{std::sin((b.longitude - a.longitude) * k / 2)};
+  const long double h{s1 * s1 + std::cos(phi1) * std::cos(phi2) * s2 * s2};
+  return 2 * EARTH_MEAN_RADIUS<long double>.v() *
+         std::asin(std::sqrt(std::min(h, 1.0L)));
+}
+
+/// Random positions.
+auto random_positions(const std::size_t size, const unsigned seed)
+    -> std::vector<LatLong<double>> {
+  std::mt19937 gen{seed};
+  std::uniform_real_distribution<double> latitude{-90, 90};
+  std::uniform_real_distribution<double> longitude{-180, 180};
+  std::vector<LatLong<double>> positions;
+  for (std::size_t i{0}; i < size; ++i)
+    positions.push_back({latitude(gen), longitude(gen)});
+  return positions;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_geodesy)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_great_circle_distance) {
+  BOOST_CHECK_EQUAL(0.0, great_circle_distance(EGLL, EGLL).v());
+  BOOST_CHECK_CLOSE(std::numbers::pi * EARTH_MEAN_RADIUS<double>.v(),
+                    great_circle_distance<double>({0, 0}, {0, 180}).v(),
+                    1e-12);
+  BOOST_CHECK_CLOSE(std::numbers::pi * EARTH_MEAN_RADIUS<double>.v(),
+                    great_circle_distance<double>({90, 0}, {-90, 0}).v(),
+                    1e-12);
+
+  const auto distance{great_circle_distance(EGLL, KJFK)};
+  BOOST_CHECK_CLOSE(static_cast<double>(reference_distance(EGLL, KJFK)),
+                    distance.v(), 1e-12);
+  BOOST_CHECK_CLOSE(2'991.07, convert<NauticalMiles<double>>(distance).v(),
+                    1e-3);
+
+  // Short distances do not lose precision.
+  const LatLong<double> threshold{51.477500, -0.485};
+  const LatLong<double> touchdown{51.477502, -0.484};
+  BOOST_CHECK_CLOSE(
+      static_cast<double>(reference_distance(threshold, touchdown)),
+      great_circle_distance(threshold, touchdown).v(), 1e-10);
+
+  const auto positions{random_positions(1'000, 1)};
+  for (std::size_t i{1}; i < positions.size(); ++i)
+    BOOST_CHECK_CLOSE(
+        static_cast<double>(reference_distance(positions[i - 1], positions[i])),
+        great_circle_distance(positions[i - 1], positions[i]).v(), 1e-10);
+
+  const LatLong<float> a{51.4775f, -0.461389f};
+  const LatLong<float> b{40.639722f, -73.778889f};
+  BOOST_CHECK_CLOSE(distance.v(), great_circle_distance(a, b).v(), 1e-4);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_great_circle_bearing) {
+  BOOST_CHECK_EQUAL(0.0, great_circle_bearing<double>({0, 0}, {10, 0}));
+  BOOST_CHECK_EQUAL(90.0, great_circle_bearing<double>({0, 0}, {0, 10}));
+  BOOST_CHECK_EQUAL(180.0, great_circle_bearing<double>({10, 0}, {0, 0}));
+  BOOST_CHECK_EQUAL(270.0, great_circle_bearing<double>({0, 0}, {0, -10}));
+  BOOST_CHECK_CLOSE(287.9316, great_circle_bearing(EGLL, KJFK), 1e-4);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_ellipsoidal) {
+  // Vincenty's example: Flinders Peak to Buninyong.
+  const LatLong<double> flinders_peak{-(37 + 57 / 60.0 + 3.72030 / 3'600),
+                                      144 + 25 / 60.0 + 29.52440 / 3'600};
+  const LatLong<double> buninyong{-(37 + 39 / 60.0 + 10.15610 / 3'600),
+                                  143 + 55 / 60.0 + 35.38390 / 3'600};
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance(flinders_peak, buninyong).v() - 54'972.271, 1e-3);
+  BOOST_CHECK_SMALL(ellipsoidal_bearing(flinders_peak, buninyong) -
+                        (306 + 52 / 60.0 + 5.37 / 3'600),
+                    1e-5);
+
+  // A degree of longitude and of latitude at the equator.
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({0, 0}, {0, 1}).v() - 111'319.4908, 1e-4);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({0, 0}, {1, 0}).v() - 110'574.3886, 1e-4);
+  BOOST_CHECK_EQUAL(0.0, ellipsoidal_distance(EGLL, EGLL).v());
+  BOOST_CHECK_CLOSE(5'554'344.276, ellipsoidal_distance(EGLL, KJFK).v(), 1e-7);
+  BOOST_CHECK_CLOSE(287.9713, ellipsoidal_bearing(EGLL, KJFK), 1e-4);
+
+  const LatLong<float> a{51.4775f, -0.461389f};
+  const LatLong<float> b{40.639722f, -73.778889f};
+  BOOST_CHECK_CLOSE(5'554'344.276f, ellipsoidal_distance(a, b).v(), 1e-4);
+
+  // Nearly antipodal and antipodal positions, where Vincenty's method does
+  // not converge: within 1 micrometre and 1e-9 degrees of GeographicLib.
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({0, 0}, {0.5, 179.7}).v() -
+          19'944'127.420750458,
+      1e-6);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_bearing<double>({0, 0}, {0.5, 179.7}) - 15.556882793490544,
+      1e-9);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({0, 0}, {0.5, 179.5}).v() -
+          19'936'288.578965314,
+      1e-6);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_bearing<double>({0, 0}, {0.5, 179.5}) - 25.67187286829188,
+      1e-9);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({-30, 0}, {30, 179.9}).v() -
+          20'003'008.42150941,
+      1e-6);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({0, 0}, {0, 180}).v() - 20'003'931.458625447,
+      1e-6);
+  BOOST_CHECK_SMALL(
+      ellipsoidal_distance<double>({90, 0}, {-90, 0}).v() -
+          20'003'931.458625447,
+      1e-6);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_great_circle_accuracy) {
+  // The great circle distance is within 0.6% of the ellipsoidal distance.
+  const auto positions{random_positions(10'000, 2)};
+  for (std::size_t i{1}; i < positions.size(); ++i) {
+    BOOST_CHECK_CLOSE(
+        ellipsoidal_distance(positions[i - 1], positions[i]).v(),
+        great_circle_distance(positions[i - 1], positions[i]).v(), 0.6);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_great_circle_distance_matrix) {
+  // Enough positions for a partial block and partial SIMD lanes.
+  const auto from{random_positions(7, 3)};
+  const auto to{random_positions(2 * 256 + 5, 4)};
+
+  // The results are bit-for-bit identical to the scalar results in Metres.
+  std::vector<Metres<double>> metres(from.size() * to.size());
+  great_circle_distance_matrix(std::span<const LatLong<double>>(from),
+                               std::span<const LatLong<double>>(to),
+                               std::span<Metres<double>>(metres));
+  for (std::size_t i{0}; i < from.size(); ++i)
+    for (std::size_t j{0}; j < to.size(); ++j)
+      BOOST_CHECK_EQUAL(great_circle_distance(from[i], to[j]),
+                        metres[i * to.size() + j]);
+
+  std::vector<NauticalMiles<double>> nautical_miles(to.size());
+  great_circle_distances(from[2], std::span<const LatLong<double>>(to),
+                         std::span<NauticalMiles<double>>(nautical_miles));
+  for (std::size_t j{0}; j < to.size(); ++j)
+    BOOST_CHECK_CLOSE(
+        convert<NauticalMiles<double>>(metres[2 * to.size() + j]).v(),
+        nautical_miles[j].v(), 1e-12);
+
+  std::vector<LatLong<float>> to_float;
+  for (const auto &position : to)
+    to_float.push_back({static_cast<float>(position.latitude),
+                        static_cast<float>(position.longitude)});
+  std::vector<Metres<float>> metres_float(to.size());
+  const LatLong<float> from_float{static_cast<float>(from[0].latitude),
+                                  static_cast<float>(from[0].longitude)};
+  great_circle_distances(from_float, std::span<const LatLong<float>>(to_float),
+                         std::span<Metres<float>>(metres_float));
+  for (std::size_t j{0}; j < to.size(); ++j)
+    BOOST_CHECK_EQUAL(great_circle_distance(from_float, to_float[j]),
+                      metres_float[j]);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,193 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains tests for the International Standard Atmosphere.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/isa.hpp"
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::isa;
+using namespace via::units::si;
+
+// The ISA functions are constexpr.
+static_assert(temperature(Metres<double>(0)) == SEA_LEVEL_TEMPERATURE<double>);
+static_assert(temperature(Metres<double>(11'000)) == Kelvin<double>(216.65));
+static_assert(pressure(Metres<double>(0)) == SEA_LEVEL_PRESSURE<double>);
+static_assert(pressure(Metres<double>(11'000)) > Pascals<double>(22'632.0));
+static_assert(pressure(Metres<double>(11'000)) < Pascals<double>(22'632.1));
+static_assert(speed_of_sound(Metres<double>(0)) >
+              MetresPerSecond<double>(340.29));
+static_assert(pressure<Fast>(Metres<double>(11'000)) > Pascals<double>(22'632.0));
+static_assert(pressure<Fast>(Metres<double>(11'000)) < Pascals<double>(22'632.1));
+
+namespace {
+/// Geopotential altitudes and values from ICAO Doc 7488.
+struct Expected {
+  double altitude;
+  double temperature;
+  double pressure;
+  double density;
+  double speed_of_sound;
+};
+
+constexpr Expected EXPECTED[]{
+    {-2'000.0, 301.15, 1.27774e5, 1.47808, 347.886},
+    {0.0, 288.15, 1.01325e5, 1.22500, 340.294},
+    {5'000.0, 255.65, 5.40199e4, 0.736116, 320.529},
+    {11'000.0, 216.65, 2.26320e4, 0.363918, 295.070},
+    {20'000.0, 216.65, 5.47487e3, 0.0880345, 295.070},
+    {32'000.0, 228.65, 8.68014e2, 0.0132249, 303.131},
+    {47'000.0, 270.65, 1.10906e2, 0.00142753, 329.799},
+    {51'000.0, 270.65, 6.69384e1, 8.61600e-4, 329.799},
+    {71'000.0, 214.65, 3.95639, 6.42105e-5, 293.704},
+    {80'000.0, 196.65, 8.86272e-1, 1.57004e-5, 281.120}};
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_isa)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_isa_values) {
+  for (const auto &expected : EXPECTED) {
+    const Metres<double> altitude(expected.altitude);
+    BOOST_CHECK_CLOSE(expected.temperature, temperature(altitude).v(), 1e-9);
+    BOOST_CHECK_CLOSE(expected.pressure, pressure(altitude).v(), 1e-3);
+    BOOST_CHECK_CLOSE(expected.density, density(altitude).v(), 1e-3);
+    BOOST_CHECK_CLOSE(expected.speed_of_sound, speed_of_sound(altitude).v(),
+                      1e-3);
+
+    const Metres<float> altitude_f(static_cast<float>(expected.altitude));
+    BOOST_CHECK_CLOSE(expected.pressure, pressure(altitude_f).v(), 1e-3);
+  }
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_isa_constexpr) {
+  // The compile time and run time functions give the same results.
+  constexpr auto layers{LAYERS<double>};
+  for (const auto &l : layers) {
+    const Metres<double> altitude(l.base_altitude + 1'234.5);
+    constexpr auto p_0{pressure(Metres<double>(1'234.5))};
+    if (l.base_altitude == 0.0)
+      BOOST_CHECK_CLOSE(p_0.v(), pressure(altitude).v(), 1e-12);
+    BOOST_CHECK_CLOSE(l.base_pressure, pressure(Metres(l.base_altitude)).v(),
+                      1e-12);
+  }
+
+  constexpr auto p_51{pressure(Metres<double>(60'000.0))};
+  BOOST_CHECK_CLOSE(p_51.v(), pressure(Metres<double>(60'000.0)).v(), 1e-12);
+  constexpr auto a_0{speed_of_sound(Metres<double>(0.0))};
+  BOOST_CHECK_CLOSE(a_0.v(), speed_of_sound(Metres<double>(0.0)).v(), 1e-12);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_isa_feet) {
+  const non_si::Feet<double> altitude(35'000.0);
+  BOOST_CHECK_EQUAL(temperature(altitude.to_metres()), temperature(altitude));
+  BOOST_CHECK_EQUAL(pressure(altitude.to_metres()), pressure(altitude));
+  BOOST_CHECK_EQUAL(density(altitude.to_metres()), density(altitude));
+  BOOST_CHECK_EQUAL(speed_of_sound(altitude.to_metres()),
+                    speed_of_sound(altitude));
+  BOOST_CHECK_CLOSE(23'842.3, pressure(altitude).v(), 1e-3);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_isa_batch) {
+  std::vector<non_si::Feet<double>> altitudes;
+  for (int i{-1}; i < 300; ++i)
+    altitudes.emplace_back(1'000.0 * i);
+  const std::span<const non_si::Feet<double>> in(altitudes);
+
+  std::vector<Kelvin<double>> temperatures(altitudes.size(), Kelvin<double>());
+  std::vector<Pascals<double>> pressures(altitudes.size());
+  std::vector<KilogramsPerCubicMetre<double>> densities(altitudes.size());
+  std::vector<MetresPerSecond<double>> speeds(altitudes.size());
+  temperature(in, std::span<Kelvin<double>>(temperatures));
+  pressure(in, std::span<Pascals<double>>(pressures));
+  density(in, std::span<KilogramsPerCubicMetre<double>>(densities));
+  speed_of_sound(in, std::span<MetresPerSecond<double>>(speeds));
+
+  for (std::size_t i{0}; i < altitudes.size(); ++i) {
+    BOOST_CHECK_EQUAL(temperature(altitudes[i]), temperatures[i]);
+    BOOST_CHECK_EQUAL(pressure(altitudes[i]), pressures[i]);
+    BOOST_CHECK_EQUAL(density(altitudes[i]), densities[i]);
+    BOOST_CHECK_EQUAL(speed_of_sound(altitudes[i]), speeds[i]);
+  }
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_isa_fast) {
+  // Compare the Fast and Exact functions every 0.25 m through the Fast tables.
+  const auto max_error_d{FAST_MAXIMUM_RELATIVE_ERROR<double>};
+  const auto max_error_f{FAST_MAXIMUM_RELATIVE_ERROR<float>};
+  double error_d{0};
+  double error_f{0};
+  for (int i{-20'000}; i < 320'000; ++i) {
+    const Metres<double> altitude(0.25 * i);
+    const auto t{temperature(altitude).v()};
+    const auto p{pressure(altitude).v()};
+    const auto rho{density(altitude).v()};
+    BOOST_REQUIRE_CLOSE(t, temperature<Fast>(altitude).v(), 1e-12);
+    error_d = std::max(error_d, std::abs(pressure<Fast>(altitude).v() / p - 1));
+    error_d = std::max(error_d, std::abs(density<Fast>(altitude).v() / rho - 1));
+
+    const Metres<float> altitude_f(static_cast<float>(altitude.v()));
+    error_f = std::max(error_f, std::abs(pressure<Fast>(altitude_f).v() / p - 1));
+    error_f = std::max(error_f, std::abs(density<Fast>(altitude_f).v() / rho - 1));
+  }
+  BOOST_CHECK_LT(error_d, max_error_d);
+  BOOST_CHECK_LT(error_f, max_error_f);
+
+  // Outside of the Fast tables, the Exact functions are evaluated.
+  for (const double a : {-5'000.5, 80'000.0, 90'000.0}) {
+    const Metres<double> altitude(a);
+    BOOST_CHECK(!interval(altitude));
+    BOOST_CHECK_EQUAL(pressure(altitude), pressure<Fast>(altitude));
+    BOOST_CHECK_EQUAL(speed_of_sound(altitude), speed_of_sound<Fast>(altitude));
+  }
+  BOOST_CHECK(!interval(Metres<double>(std::numeric_limits<double>::quiet_NaN())));
+
+  // The Fast functions are evaluated in batches and in Feet.
+  std::vector<non_si::Feet<double>> altitudes;
+  for (int i{-10}; i < 300; ++i)
+    altitudes.emplace_back(1'000.0 * i);
+  const std::span<const non_si::Feet<double>> in(altitudes);
+  std::vector<Pascals<double>> pressures(altitudes.size());
+  pressure<Fast>(in, std::span<Pascals<double>>(pressures));
+  for (std::size_t i{0}; i < altitudes.size(); ++i) {
+    BOOST_CHECK_EQUAL(pressure<Fast>(altitudes[i].to_metres()), pressures[i]);
+    BOOST_CHECK_CLOSE(pressure(altitudes[i]).v(), pressures[i].v(),
+                      100 * max_error_d);
+  }
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
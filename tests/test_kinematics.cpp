@@ -0,0 +1,263 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+/// @file
+/// @brief Contains tests for the time units and the functions in
+/// kinematics.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/kinematics.hpp"
+#include "via/units/non_si.hpp"
+#include <array>
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::kinematics;
+using namespace via::units::non_si;
+using namespace via::units::si;
+
+// Speeds multiplied by times, and accelerations by times, are typed.
+static_assert(
+    std::is_same_v<Metres<double>,
+                   decltype(MetresPerSecond<double>() * Seconds<double>())>);
+static_assert(
+    std::is_same_v<MetresPerSecond<double>,
+                   decltype(MetresPerSecondSquared<double>() *
+                            Seconds<double>())>);
+static_assert(std::is_same_v<Hours<double>, decltype(NauticalMiles<double>() /
+                                                    Knots<double>())>);
+static_assert(Knots<double>(480) * Hours<double>(0.5) ==
+              NauticalMiles<double>(240));
+static_assert(FeetPerMinute<float>(1'500) * Minutes<float>(2) ==
+              Feet<float>(3'000));
+static_assert(Hours<double>::si_factor == 3'600.0 &&
+              Minutes<double>::si_factor == 60.0);
+static_assert(convert<Minutes<double>>(Hours<double>(1.5)) ==
+              Minutes<double>(90));
+
+// Displacements, positions and speeds are constexpr.
+static_assert(displacement<Metres<double>>(MetresPerSecond<double>(100),
+                                           MetresPerSecondSquared<double>(2),
+                                           Seconds<double>(10)) ==
+              Metres<double>(1'100));
+static_assert(advance(Metres<double>(500), MetresPerSecond<double>(100),
+                      MetresPerSecondSquared<double>(2),
+                      Seconds<double>(10)) == Metres<double>(1'600));
+static_assert(accelerate(MetresPerSecond<double>(10),
+                         MetresPerSecondSquared<double>(2),
+                         Minutes<double>(1)) == MetresPerSecond<double>(130));
+
+namespace {
+/// Whether a and b have the same bit pattern.
+template <typename T> auto same_bits(const T a, const T b) -> bool {
+  return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/// Random units, uniformly distributed in [low, high).
+template <typename U>
+auto random_units(const std::size_t size, const unit_value_t<U> low,
+                  const unit_value_t<U> high, const unsigned seed)
+    -> std::vector<U> {
+  std::mt19937 gen{seed};
+  std::uniform_real_distribution<unit_value_t<U>> dist{low, high};
+  std::vector<U> units;
+  for (std::size_t i{0}; i < size; ++i)
+    units.emplace_back(dist(gen));
+  return units;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_kinematics)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_time_units) {
+  const Minutes<double> minutes(90);
+  const Hours<double> hours(1.5);
+  BOOST_CHECK_EQUAL("Minutes(90)", minutes.python_repr());
+  BOOST_CHECK_EQUAL("Hours(1.5)", hours.python_repr());
+  BOOST_CHECK_EQUAL(Seconds<double>(5'400), minutes.to_si());
+  BOOST_CHECK_EQUAL(Seconds<double>(5'400), hours.to_si());
+  BOOST_CHECK_EQUAL(hours, convert<Hours<double>>(minutes));
+
+  std::array<char, TO_CHARS_MAX_SIZE> buffer;
+  auto result{to_chars(buffer.data(), buffer.data() + buffer.size(), hours,
+                       true)};
+  BOOST_CHECK_EQUAL("1.5 h", std::string_view(buffer.data(), result.ptr));
+  result = to_chars(buffer.data(), buffer.data() + buffer.size(), minutes,
+                    true);
+  BOOST_CHECK_EQUAL("90 min", std::string_view(buffer.data(), result.ptr));
+
+  const FeetPerMinute<double> vertical_speed(-2'000);
+  BOOST_CHECK_EQUAL("FeetPerMinute(-2000)", vertical_speed.python_repr());
+  result = to_chars(buffer.data(), buffer.data() + buffer.size(),
+                    vertical_speed, true);
+  BOOST_CHECK_EQUAL("-2000 ft/min",
+                    std::string_view(buffer.data(), result.ptr));
+  BOOST_CHECK_CLOSE(-10.16, vertical_speed.to_si().v(), 1e-12);
+
+  // Knots multiplied by Seconds are a length in a unit without a name.
+  const auto distance{Knots<double>(360) * Seconds<double>(10)};
+  BOOST_CHECK_CLOSE(1.0, convert<NauticalMiles<double>>(distance).v(), 1e-12);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_displacement) {
+  BOOST_CHECK_CLOSE(1.0,
+                    displacement<NauticalMiles<double>>(Knots<double>(360),
+                                                        Seconds<double>(10))
+                        .v(),
+                    1e-12);
+  BOOST_CHECK_CLOSE(
+      1'000.0,
+      displacement<Feet<float>>(FeetPerMinute<float>(1'000), Minutes<float>(1))
+          .v(),
+      1e-5);
+  BOOST_CHECK_CLOSE(
+      3'000.0,
+      displacement<Feet<double>>(FeetPerMinute<double>(1'500),
+                                 Seconds<double>(120))
+          .v(),
+      1e-12);
+
+  // 1 m/s^2 for a minute from rest: 1800 m and 60 m/s.
+  BOOST_CHECK_CLOSE(
+      1'800.0 / 1'852.0,
+      displacement<NauticalMiles<double>>(Knots<double>(),
+                                          MetresPerSecondSquared<double>(1),
+                                          Minutes<double>(1))
+          .v(),
+      1e-12);
+  BOOST_CHECK_CLOSE(
+      convert<Knots<double>>(MetresPerSecond<double>(60)).v(),
+      accelerate(Knots<double>(), MetresPerSecondSquared<double>(1),
+                 Minutes<double>(1))
+          .v(),
+      1e-12);
+
+  // The displacement is consistent with the typed operators.
+  const Knots<double> speed(250);
+  const MetresPerSecondSquared<double> acceleration(0.5);
+  const Seconds<double> time(30);
+  const auto expected{convert<MetresPerSecond<double>>(speed) * time +
+                      acceleration * time * time / 2.0};
+  BOOST_CHECK_CLOSE(
+      expected.v(),
+      displacement<Metres<double>>(speed, acceleration, time).v(), 1e-12);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_integrate) {
+  // Enough values for the SIMD lanes and a scalar tail.
+  constexpr std::size_t SIZE{1'003};
+  const auto positions{random_units<NauticalMiles<double>>(SIZE, 0, 1'000, 1)};
+  const auto speeds{random_units<Knots<double>>(SIZE, 100, 500, 2)};
+  const auto accelerations{
+      random_units<MetresPerSecondSquared<double>>(SIZE, -1, 1, 3)};
+  const Seconds<double> time(4);
+
+  // The results are bit-for-bit identical to the scalar functions.
+  auto p{positions};
+  auto v{speeds};
+  integrate(std::span<NauticalMiles<double>>(p), std::span<Knots<double>>(v),
+            std::span<const MetresPerSecondSquared<double>>(accelerations),
+            time);
+  for (std::size_t i{0}; i < SIZE; ++i) {
+    BOOST_CHECK(same_bits(
+        advance(positions[i], speeds[i], accelerations[i], time).v(),
+        p[i].v()));
+    BOOST_CHECK(same_bits(accelerate(speeds[i], accelerations[i], time).v(),
+                          v[i].v()));
+    BOOST_CHECK_CLOSE(
+        (positions[i] + displacement<NauticalMiles<double>>(
+                            speeds[i], accelerations[i], time))
+            .v(),
+        p[i].v(), 1e-12);
+  }
+
+  p = positions;
+  integrate(std::span<NauticalMiles<double>>(p),
+            std::span<const Knots<double>>(speeds), time);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(
+        same_bits(advance(positions[i], speeds[i], time).v(), p[i].v()));
+
+  // Altitudes and vertical speeds in float.
+  const auto altitudes{random_units<Feet<float>>(SIZE, 0, 40'000, 4)};
+  const auto vertical_speeds{
+      random_units<FeetPerMinute<float>>(SIZE, -3'000, 3'000, 5)};
+  const Minutes<float> minutes(0.5f);
+  auto h{altitudes};
+  integrate(std::span<Feet<float>>(h),
+            std::span<const FeetPerMinute<float>>(vertical_speeds), minutes);
+  for (std::size_t i{0}; i < SIZE; ++i) {
+    BOOST_CHECK(same_bits(
+        advance(altitudes[i], vertical_speeds[i], minutes).v(), h[i].v()));
+    BOOST_CHECK_CLOSE(altitudes[i].v() + vertical_speeds[i].v() / 2, h[i].v(),
+                      1e-4);
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_integrate_parallel) {
+  // Enough values for several chunks, with a partial last chunk.
+  constexpr std::size_t SIZE{100'003};
+  const auto positions{random_units<Metres<double>>(SIZE, 0, 1e6, 1)};
+  const auto speeds{random_units<MetresPerSecond<double>>(SIZE, 50, 250, 2)};
+  const auto accelerations{
+      random_units<MetresPerSecondSquared<double>>(SIZE, -1, 1, 3)};
+  const Seconds<double> time(1);
+
+  ThreadPool pool(4);
+  const Parallel policy{.threshold = 1'000, .pool = &pool};
+
+  // The results are bit-for-bit identical to the sequenced results, after
+  // several steps.
+  auto p_seq{positions};
+  auto v_seq{speeds};
+  auto p_par{positions};
+  auto v_par{speeds};
+  const std::span<const MetresPerSecondSquared<double>> a(accelerations);
+  for (int step{0}; step < 10; ++step) {
+    integrate(seq, std::span<Metres<double>>(p_seq),
+              std::span<MetresPerSecond<double>>(v_seq), a, time);
+    integrate(policy, std::span<Metres<double>>(p_par),
+              std::span<MetresPerSecond<double>>(v_par), a, time);
+  }
+  for (std::size_t i{0}; i < SIZE; ++i) {
+    BOOST_CHECK(same_bits(p_seq[i].v(), p_par[i].v()));
+    BOOST_CHECK(same_bits(v_seq[i].v(), v_par[i].v()));
+  }
+
+  integrate(policy, std::span<Metres<double>>(p_par),
+            std::span<const MetresPerSecond<double>>(v_par), time);
+  integrate(std::span<Metres<double>>(p_seq),
+            std::span<const MetresPerSecond<double>>(v_seq), time);
+  for (std::size_t i{0}; i < SIZE; ++i)
+    BOOST_CHECK(same_bits(p_seq[i].v(), p_par[i].v()));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
@@ -45,7 +45,7 @@ BOOST_AUTO_TEST_CASE(test_NauticalMiles_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("NauticalMiles(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("NauticalMiles(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -78,7 +78,7 @@ BOOST_AUTO_TEST_CASE(test_Feet_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("Feet(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Feet(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -111,7 +111,7 @@ BOOST_AUTO_TEST_CASE(test_Knots_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("Knots(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Knots(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
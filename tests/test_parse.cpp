@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains tests for parsing units from text in parse.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/parse.hpp"
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::si;
+using namespace via::units::non_si;
+
+namespace {
+/// Parse a value from a string.
+template <typename U>
+auto parse(const std::string_view text, U &value) -> std::from_chars_result {
+  return from_chars(text.data(), text.data() + text.size(), value);
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_parse)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_parse_unit) {
+  ParsedUnit<double> value;
+
+  const std::string_view flight_level{"FL350"};
+  auto result{parse(flight_level, value)};
+  BOOST_CHECK(std::errc() == result.ec);
+  BOOST_CHECK_EQUAL(flight_level.data() + flight_level.size(), result.ptr);
+  BOOST_CHECK_EQUAL(Feet<double>(35'000), std::get<Feet<double>>(value));
+
+  BOOST_CHECK(std::errc() == parse("250kt", value).ec);
+  BOOST_CHECK_EQUAL(Knots<double>(250), std::get<Knots<double>>(value));
+  BOOST_CHECK(std::errc() == parse("250 KT", value).ec);
+  BOOST_CHECK_EQUAL(Knots<double>(250), std::get<Knots<double>>(value));
+  BOOST_CHECK(std::errc() == parse("5000ft", value).ec);
+  BOOST_CHECK_EQUAL(Feet<double>(5'000), std::get<Feet<double>>(value));
+  BOOST_CHECK(std::errc() == parse("-1500FT", value).ec);
+  BOOST_CHECK_EQUAL(Feet<double>(-1'500), std::get<Feet<double>>(value));
+  BOOST_CHECK(std::errc() == parse("12.5NM", value).ec);
+  BOOST_CHECK_EQUAL(NauticalMiles<double>(12.5),
+                    std::get<NauticalMiles<double>>(value));
+  BOOST_CHECK(std::errc() == parse("1852 m", value).ec);
+  BOOST_CHECK_EQUAL(Metres<double>(1'852), std::get<Metres<double>>(value));
+
+  // Parsing stops at the end of the value.
+  const std::string_view text{"250kt,5000ft"};
+  result = parse(text, value);
+  BOOST_CHECK(std::errc() == result.ec);
+  BOOST_CHECK_EQUAL(text.data() + 5, result.ptr);
+
+  // Invalid values
+  for (const auto *invalid : {"250", "250 ", "250km", "250ftx", "250ft3", "ft",
+                              "FL", "FLx", "FL-10", "FL350.5", "FL350ft",
+                              "5000 nm", "", " 250kt"}) {
+    const std::string_view s{invalid};
+    result = parse(s, value);
+    BOOST_CHECK_MESSAGE(std::errc::invalid_argument == result.ec, invalid);
+    BOOST_CHECK_EQUAL(s.data(), result.ptr);
+  }
+  BOOST_CHECK(std::errc::result_out_of_range == parse("1e999ft", value).ec);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_parse_quantity) {
+  Feet<double> altitude;
+  BOOST_CHECK(std::errc() == parse("5000", altitude).ec);
+  BOOST_CHECK_EQUAL(Feet<double>(5'000), altitude);
+  BOOST_CHECK(std::errc() == parse("FL50", altitude).ec);
+  BOOST_CHECK_EQUAL(Feet<double>(5'000), altitude);
+  BOOST_CHECK(std::errc() == parse("1524m", altitude).ec);
+  BOOST_CHECK_EQUAL(convert<Feet<double>>(Metres<double>(1'524)), altitude);
+  BOOST_CHECK(std::errc() == parse("1NM", altitude).ec);
+  BOOST_CHECK_EQUAL(convert<Feet<double>>(NauticalMiles<double>(1)), altitude);
+
+  Knots<float> speed;
+  BOOST_CHECK(std::errc() == parse("250kt", speed).ec);
+  BOOST_CHECK_EQUAL(Knots<float>(250), speed);
+
+  // The unit symbol has a different dimension.
+  BOOST_CHECK(std::errc::invalid_argument == parse("250kt", altitude).ec);
+  BOOST_CHECK(std::errc::invalid_argument == parse("FL350", speed).ec);
+
+  // An unnamed unit parses values without a unit symbol.
+  MetresPerSecondSquared<double> acceleration;
+  BOOST_CHECK(std::errc() == parse("9.80665", acceleration).ec);
+  BOOST_CHECK_EQUAL(MetresPerSecondSquared<double>(9.806'65), acceleration);
+  BOOST_CHECK(std::errc::invalid_argument == parse("9.8m", acceleration).ec);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_parse_column) {
+  std::vector<Feet<double>> altitudes(5);
+  const std::span<Feet<double>> out(altitudes);
+
+  const std::string_view text{" FL350, 5000ft ,1524 m\n-100\n2.5e3\r\n\n"};
+  auto result{parse_column(text, out)};
+  BOOST_CHECK(std::errc() == result.ec);
+  BOOST_CHECK_EQUAL(5u, result.count);
+  BOOST_CHECK_EQUAL(text.data() + text.size(), result.ptr);
+  BOOST_CHECK_EQUAL(Feet<double>(35'000), altitudes[0]);
+  BOOST_CHECK_EQUAL(Feet<double>(5'000), altitudes[1]);
+  BOOST_CHECK_EQUAL(convert<Feet<double>>(Metres<double>(1'524)), altitudes[2]);
+  BOOST_CHECK_EQUAL(Feet<double>(-100), altitudes[3]);
+  BOOST_CHECK_EQUAL(Feet<double>(2'500), altitudes[4]);
+
+  // Tab delimited
+  result = parse_column("1\t2", out, '\t');
+  BOOST_CHECK(std::errc() == result.ec);
+  BOOST_CHECK_EQUAL(2u, result.count);
+
+  // An empty column
+  result = parse_column(" \n", out);
+  BOOST_CHECK(std::errc() == result.ec);
+  BOOST_CHECK_EQUAL(0u, result.count);
+
+  // Errors report the position of the failing value.
+  const std::string_view invalid{"FL350,250kt,5000ft"};
+  result = parse_column(invalid, out);
+  BOOST_CHECK(std::errc::invalid_argument == result.ec);
+  BOOST_CHECK_EQUAL(1u, result.count);
+  BOOST_CHECK_EQUAL(invalid.data() + 6, result.ptr);
+
+  const std::string_view empty_value{"1,,3"};
+  result = parse_column(empty_value, out);
+  BOOST_CHECK(std::errc::invalid_argument == result.ec);
+  BOOST_CHECK_EQUAL(1u, result.count);
+  BOOST_CHECK_EQUAL(empty_value.data() + 2, result.ptr);
+
+  const std::string_view missing_delimiter{"1 2"};
+  result = parse_column(missing_delimiter, out);
+  BOOST_CHECK(std::errc::invalid_argument == result.ec);
+  BOOST_CHECK_EQUAL(1u, result.count);
+  BOOST_CHECK_EQUAL(missing_delimiter.data() + 2, result.ptr);
+
+  const std::string_view too_many{"1,2,3,4,5,6"};
+  result = parse_column(too_many, out);
+  BOOST_CHECK(std::errc::value_too_large == result.ec);
+  BOOST_CHECK_EQUAL(5u, result.count);
+  BOOST_CHECK_EQUAL(too_many.data() + 10, result.ptr);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
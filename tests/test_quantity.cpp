@@ -0,0 +1,322 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+/// @file
+/// @brief Contains tests for the Quantity type in quantity.hpp.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units/non_si.hpp"
+#include <array>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::si;
+using namespace via::units::non_si;
+
+// The unit types are the same size and layout as their values.
+static_assert(sizeof(Metres<double>) == sizeof(double));
+static_assert(sizeof(Feet<float>) == sizeof(float));
+static_assert(std::is_trivially_copyable_v<Knots<double>>);
+static_assert(std::is_standard_layout_v<Pascals<double>>);
+static_assert(sizeof(FlightLevels<std::int16_t>) == sizeof(std::int16_t));
+static_assert(sizeof(Feet<std::int32_t>) == sizeof(std::int32_t));
+
+// The Unit concept and traits.
+static_assert(Unit<Metres<double>> && Unit<const Knots<float>> &&
+              Unit<FlightLevels<std::int16_t>>);
+static_assert(!Unit<double> && !Unit<std::int32_t>);
+static_assert(std::is_same_v<float, unit_value_t<Feet<float>>>);
+static_assert(std::is_same_v<Speed, unit_dimension_t<Knots<double>>>);
+static_assert(
+    std::is_same_v<MetresPerSecond<double>, unit_si_t<Knots<double>>>);
+static_assert(unit_si_factor_v<NauticalMiles<double>> == 1'852.0);
+static_assert(unit_si_factor_v<Feet<std::int32_t>> == 0.3048);
+static_assert(unit_traits<Metres<double>>::is_si &&
+              !unit_traits<Feet<double>>::is_si);
+static_assert(unit_traits<Knots<float>>::has_addition &&
+              unit_traits<Knots<float>>::has_scaling &&
+              unit_traits<Knots<float>>::has_product &&
+              unit_traits<Knots<float>>::has_to_si);
+static_assert(unit_traits<Feet<std::int32_t>>::has_addition &&
+              !unit_traits<Feet<std::int32_t>>::has_to_si);
+
+// Derived units have the correct types.
+static_assert(std::is_same_v<MetresPerSecond<double>,
+                             decltype(Metres<double>() / Seconds<double>())>);
+static_assert(
+    std::is_same_v<MetresPerSecondSquared<double>,
+                   decltype(MetresPerSecond<double>() / Seconds<double>())>);
+static_assert(
+    std::is_same_v<Metres<double>,
+                   decltype(MetresPerSecond<double>() * Seconds<double>())>);
+static_assert(std::is_same_v<Pascals<double>,
+                             decltype(Kilograms<double>() *
+                                      MetresPerSecondSquared<double>() /
+                                      (Metres<double>() * Metres<double>()))>);
+static_assert(std::is_same_v<double,
+                             decltype(Metres<double>() / Metres<double>())>);
+static_assert(
+    std::is_same_v<Quantity<Length, KnotRatio, double>,
+                   decltype(Knots<double>() * Seconds<double>())>);
+
+// Quantities are constexpr.
+static_assert(Metres<double>(100) / Seconds<double>(10) ==
+              MetresPerSecond<double>(10));
+static_assert(NauticalMiles<double>(1).to_metres() == Metres<double>(1'852));
+static_assert(convert<Feet<double>>(FlightLevels<std::int16_t>(350)) ==
+              Feet<double>(35'000));
+
+namespace {
+/// A generic algorithm for any unit: copy the values of the units and scale
+/// them to SI values.
+template <Unit U>
+auto si_values(const std::vector<U> &units) -> std::vector<double> {
+  std::vector<unit_value_t<U>> values(units.size());
+  std::memcpy(values.data(), units.data(), units.size() * sizeof(U));
+  std::vector<double> result;
+  for (const auto value : values)
+    result.push_back(static_cast<double>(value) *
+                     static_cast<double>(unit_si_factor_v<U>));
+  return result;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_quantity)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_Seconds_traits) {
+  const auto zero{Seconds<double>()};
+  BOOST_CHECK_EQUAL(0.0, zero.v());
+  const auto one{Seconds<double>(1)};
+  BOOST_CHECK_EQUAL(one, one);
+  const auto minus_one{Seconds<double>(-1)};
+  BOOST_CHECK(minus_one < one);
+  BOOST_CHECK(minus_one <= one);
+  BOOST_CHECK_EQUAL(minus_one, -one);
+
+  BOOST_CHECK(minus_one != one);
+  BOOST_CHECK(one > minus_one);
+  BOOST_CHECK(one >= minus_one);
+
+  const auto two{Seconds<double>(2)};
+  BOOST_CHECK_EQUAL(two, one + one);
+  BOOST_CHECK_EQUAL(one, two - one);
+
+  auto one_clone{one};
+  BOOST_CHECK_EQUAL(minus_one, one_clone -= two);
+  BOOST_CHECK_EQUAL(one, one_clone += two);
+
+  BOOST_CHECK_EQUAL("Seconds(1)", one.python_repr());
+
+  std::stringstream stream;
+  stream << minus_one;
+  BOOST_CHECK_EQUAL("-1", stream.str());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_derived_units) {
+  const Metres<double> distance(1'000.0);
+  const Seconds<double> time(8.0);
+
+  const MetresPerSecond<double> speed{distance / time};
+  BOOST_CHECK_EQUAL(1'000.0 / 8.0, speed.v());
+  BOOST_CHECK_EQUAL(distance, speed * time);
+
+  const MetresPerSecondSquared<double> acceleration{speed / time};
+  BOOST_CHECK_EQUAL(1'000.0 / 8.0 / 8.0, acceleration.v());
+
+  const Kilograms<double> mass(1.225);
+  const KilogramsPerCubicMetre<double> density{
+      mass / (Metres<double>(1) * Metres<double>(1) * Metres<double>(1))};
+  BOOST_CHECK_EQUAL(1.225, density.v());
+  BOOST_CHECK_EQUAL("KilogramsPerCubicMetre(1.225)", density.python_repr());
+
+  BOOST_CHECK_EQUAL(125.0, distance / Metres<double>(8.0));
+
+  // An unnamed derived unit
+  const auto area{distance * distance};
+  BOOST_CHECK_EQUAL("Quantity(1e+06)", area.python_repr());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_scalar_arithmetic) {
+  const Feet<double> altitude(1'000.0);
+  BOOST_CHECK_EQUAL(Feet<double>(2'000.0), altitude * 2.0);
+  BOOST_CHECK_EQUAL(Feet<double>(2'000.0), 2.0 * altitude);
+  BOOST_CHECK_EQUAL(Feet<double>(500.0), altitude / 2.0);
+
+  auto value{altitude};
+  value *= 4.0;
+  BOOST_CHECK_EQUAL(Feet<double>(4'000.0), value);
+  value /= 8.0;
+  BOOST_CHECK_EQUAL(Feet<double>(500.0), value);
+
+  BOOST_CHECK_EQUAL(Feet<double>(1'500.0), altitude + value);
+  BOOST_CHECK_EQUAL(Feet<double>(500.0), altitude - value);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_to_si) {
+  // The conversions are identical to the raw floating point conversions.
+  for (const auto value : {-1.0, 0.1, 1.0, 123.456, 35'000.0}) {
+    BOOST_CHECK_EQUAL(value * METRES_PER_FOOT<double>,
+                      Feet<double>(value).to_si().v());
+    BOOST_CHECK_EQUAL(value / METRES_PER_FOOT<double>,
+                      Feet<double>(Metres<double>(value)).v());
+    BOOST_CHECK_EQUAL(value * METRES_PER_SECOND_TO_KNOTS<double>,
+                      Knots<double>(value).to_si().v());
+    BOOST_CHECK_EQUAL(value * METRES_PER_NAUTICAL_MILE<double>,
+                      NauticalMiles<double>(value).to_si().v());
+  }
+
+  BOOST_CHECK_EQUAL(Metres<double>(2.0), Metres<double>(2.0).to_si());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_convert) {
+  // The fused factors are calculated exactly in long double.
+  static_assert(conversion_factor<NauticalMiles<double>, Feet<double>> ==
+                static_cast<double>(0.3048L / 1'852.0L));
+  static_assert(conversion_factor<Feet<double>, NauticalMiles<double>> ==
+                static_cast<double>(1'852.0L / 0.3048L));
+  static_assert(conversion_factor<Metres<float>, Feet<float>> ==
+                METRES_PER_FOOT<float>);
+  static_assert(conversion_factor<Knots<double>, Knots<double>> == 1.0);
+
+  const Feet<double> altitude(35'000.0);
+  const auto distance{convert<NauticalMiles<double>>(altitude)};
+  BOOST_CHECK_EQUAL(35'000.0 * static_cast<double>(0.3048L / 1'852.0L),
+                    distance.v());
+  BOOST_CHECK_CLOSE(altitude.to_metres().v() / METRES_PER_NAUTICAL_MILE<double>,
+                    distance.v(), 1e-12);
+  BOOST_CHECK_CLOSE(35'000.0, convert<Feet<double>>(distance).v(), 1e-12);
+
+  // Conversions to SI units are identical to to_si.
+  BOOST_CHECK_EQUAL(altitude.to_metres(), convert<Metres<double>>(altitude));
+  BOOST_CHECK_EQUAL(Knots<float>(250.0f).to_metres_per_second(),
+                    convert<MetresPerSecond<float>>(Knots<float>(250.0f)));
+
+  BOOST_CHECK_EQUAL(altitude, convert<Feet<double>>(altitude));
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_integer_quantities) {
+  // Integer quantities are added, subtracted and compared exactly.
+  const FlightLevels<std::int16_t> cruise(350);
+  BOOST_CHECK_EQUAL(FlightLevels<std::int16_t>(370),
+                    cruise + FlightLevels<std::int16_t>(20));
+  BOOST_CHECK_EQUAL(FlightLevels<std::int16_t>(-350), -cruise);
+  BOOST_CHECK(FlightLevels<std::int16_t>(330) < cruise);
+  BOOST_CHECK_EQUAL(Feet<std::int32_t>(1'000) * 3, Feet<std::int32_t>(3'000));
+
+  // They are widened to floating point units.
+  BOOST_CHECK_EQUAL(Feet<float>(35'000), convert<Feet<float>>(cruise));
+  BOOST_CHECK_EQUAL(35'000.0 * METRES_PER_FOOT<double>,
+                    convert<Metres<double>>(Feet<std::int32_t>(35'000)).v());
+  BOOST_CHECK_CLOSE(35'000.0 * METRES_PER_FOOT<double>,
+                    convert<Metres<double>>(cruise).v(), 1e-13);
+
+  // Floating point units are narrowed to the nearest whole unit.
+  BOOST_CHECK_EQUAL(Feet<std::int32_t>(35'000),
+                    convert<Feet<std::int32_t>>(Metres<double>(10'668.1)));
+  BOOST_CHECK_EQUAL(FlightLevels<std::int16_t>(350),
+                    convert<FlightLevels<std::int16_t>>(Feet<double>(34'960)));
+  BOOST_CHECK_EQUAL(FlightLevels<std::int16_t>(-5),
+                    convert<FlightLevels<std::int16_t>>(Feet<float>(-460)));
+
+  std::array<char, TO_CHARS_MAX_SIZE> buffer;
+  const auto result{
+      to_chars(buffer.data(), buffer.data() + buffer.size(), cruise, true)};
+  BOOST_CHECK_EQUAL("350 FL", std::string(buffer.data(), result.ptr));
+  BOOST_CHECK_EQUAL("FlightLevels(350)", cruise.python_repr());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_generic_units) {
+  const std::vector<Feet<std::int32_t>> altitudes{Feet<std::int32_t>(1'000),
+                                                  Feet<std::int32_t>(-10)};
+  const auto metres{si_values(altitudes)};
+  BOOST_CHECK_EQUAL(304.8, metres[0]);
+  BOOST_CHECK_EQUAL(-3.048, metres[1]);
+
+  const std::vector<Knots<float>> speeds{Knots<float>(3'600)};
+  BOOST_CHECK_CLOSE(1'852.0, si_values(speeds)[0], 1e-5);
+
+  const std::vector<Kelvin<double>> temperatures{Kelvin<double>(288.15)};
+  BOOST_CHECK_EQUAL(288.15, si_values(temperatures)[0]);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_to_chars) {
+  std::array<char, TO_CHARS_MAX_SIZE> buffer;
+  const auto write{[&buffer](const auto value, const bool with_symbol) {
+    const auto result{to_chars(buffer.data(), buffer.data() + buffer.size(),
+                               value, with_symbol)};
+    BOOST_CHECK(std::errc() == result.ec);
+    return std::string(buffer.data(), result.ptr);
+  }};
+
+  BOOST_CHECK_EQUAL("1852", write(Metres<double>(1'852), false));
+  BOOST_CHECK_EQUAL("1852 m", write(Metres<double>(1'852), true));
+  BOOST_CHECK_EQUAL("350 ft", write(Feet<double>(350), true));
+  BOOST_CHECK_EQUAL("250 kt", write(Knots<float>(250), true));
+  BOOST_CHECK_EQUAL("12.5 NM", write(NauticalMiles<double>(12.5), true));
+  BOOST_CHECK_EQUAL("1.225 kg/m^3",
+                    write(KilogramsPerCubicMetre<double>(1.225), true));
+  BOOST_CHECK_EQUAL("1e+06", write(Metres<double>(1e6) * Metres<double>(1),
+                                   true));
+
+  // The shortest representation round trips.
+  const auto value{Metres<double>(0.1) + Metres<double>(0.2)};
+  BOOST_CHECK_EQUAL("0.30000000000000004 m", write(value, true));
+  const MetresPerSecondSquared<double> min(-std::numeric_limits<double>::min());
+  BOOST_CHECK_EQUAL("-2.2250738585072014e-308 m/s^2", write(min, true));
+
+  // The buffer is too small for the unit symbol.
+  const auto result{to_chars(buffer.data(), buffer.data() + 5,
+                             Pascals<double>(1'000), true)};
+  BOOST_CHECK(std::errc::value_too_large == result.ec);
+
+#ifdef __cpp_lib_format
+  BOOST_CHECK_EQUAL("1852", std::format("{}", Metres<double>(1'852)));
+  BOOST_CHECK_EQUAL("1852 m", std::format("{:u}", Metres<double>(1'852)));
+  BOOST_CHECK_EQUAL("350.0 ft", std::format("{:u.1f}", Feet<double>(350)));
+  BOOST_CHECK_EQUAL("  250 kt", std::format("{:u5}", Knots<double>(250)));
+  BOOST_CHECK_EQUAL("1e+06", std::format("{:u}", Metres<double>(1e6) *
+                                                     Metres<double>(1)));
+#endif
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////
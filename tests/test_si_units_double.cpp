@@ -54,7 +54,7 @@ BOOST_AUTO_TEST_CASE(test_Metres_traits) {
   BOOST_CHECK_EQUAL(minus_one, one_clone -= two);
   BOOST_CHECK_EQUAL(one, one_clone += two);
 
-  BOOST_CHECK_EQUAL("Metres(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Metres(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -85,7 +85,7 @@ BOOST_AUTO_TEST_CASE(test_MetresPerSecond_traits) {
   BOOST_CHECK_EQUAL(minus_one, one_clone -= two);
   BOOST_CHECK_EQUAL(one, one_clone += two);
 
-  BOOST_CHECK_EQUAL("MetresPerSecond(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("MetresPerSecond(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -108,7 +108,7 @@ BOOST_AUTO_TEST_CASE(test_MetresPerSecondSquared_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("MetresPerSecondSquared(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("MetresPerSecondSquared(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -137,7 +137,7 @@ BOOST_AUTO_TEST_CASE(test_Kelvin_traits) {
   BOOST_CHECK_EQUAL(minus_one, one_clone -= two);
   BOOST_CHECK_EQUAL(one, one_clone += two);
 
-  BOOST_CHECK_EQUAL("Kelvin(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Kelvin(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -158,7 +158,7 @@ BOOST_AUTO_TEST_CASE(test_Pascals_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("Pascals(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Pascals(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -189,7 +189,7 @@ BOOST_AUTO_TEST_CASE(test_Kilograms_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("Kilograms(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("Kilograms(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -210,7 +210,7 @@ BOOST_AUTO_TEST_CASE(test_KilogramsPerCubicMetre_traits) {
   BOOST_CHECK(one > minus_one);
   BOOST_CHECK(one >= minus_one);
 
-  BOOST_CHECK_EQUAL("KilogramsPerCubicMetre(1.000000)", one.python_repr());
+  BOOST_CHECK_EQUAL("KilogramsPerCubicMetre(1)", one.python_repr());
 
   std::stringstream stream;
   stream << minus_one;
@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Ken Barker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+//
+/// @file
+/// @brief Contains tests for the tracing hooks in trace.hpp.
+/// The tests are built without `VIA_UNITS_TRACE` in via-units_test, and
+/// with it in via-units_trace_test.
+//////////////////////////////////////////////////////////////////////////////
+#include "via/units.hpp"
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace via::units;
+using namespace via::units::non_si;
+using namespace via::units::si;
+
+#define TEST_STRINGIFY(...) #__VA_ARGS__
+#define TEST_EXPANDED_STRING(...) TEST_STRINGIFY(__VA_ARGS__)
+
+#ifdef VIA_UNITS_TRACE
+static_assert(trace::ENABLED);
+#else
+// Without VIA_UNITS_TRACE the hooks expand to nothing, so the batch
+// functions are unchanged.
+static_assert(!trace::ENABLED);
+static_assert(std::string_view(TEST_EXPANDED_STRING(VIA_UNITS_TRACE_CALL(
+                  "convert", in.size(), From, To)))
+                  .empty());
+#endif
+
+namespace {
+/// The record of function with units, nullptr if there is none.
+auto find_record(const std::vector<trace::Record> &records,
+                 const std::string_view function, const std::string_view units)
+    -> const trace::Record * {
+  const auto record{std::ranges::find_if(records, [&](const auto &r) {
+    return r.function == function && r.units == units;
+  })};
+  return record != records.end() ? &*record : nullptr;
+}
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_SUITE(Test_trace)
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_type_names) {
+  BOOST_CHECK_EQUAL("Feet<float>", trace::type_name<Feet<float>>::get());
+  BOOST_CHECK_EQUAL("Metres<double>", trace::type_name<Metres<double>>::get());
+  BOOST_CHECK_EQUAL("FlightLevels<int16_t>",
+                    trace::type_name<FlightLevels<std::int16_t>>::get());
+  BOOST_CHECK_EQUAL("double", trace::type_name<double>::get());
+  BOOST_CHECK_EQUAL(
+      "Cas<Knots<double>>",
+      trace::type_name<airspeed::Cas<Knots<double>>>::get());
+  BOOST_CHECK_EQUAL("Mach<float>",
+                    trace::type_name<airspeed::Mach<float>>::get());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_snapshot) {
+  trace::reset();
+
+  const std::vector<Feet<float>> feet(1'000, Feet<float>(100));
+  std::vector<Metres<double>> metres(feet.size());
+  convert(std::span<const Feet<float>>(feet),
+          std::span<Metres<double>>(metres));
+
+  const std::vector<Feet<double>> altitudes(10, Feet<double>(1'000));
+  std::vector<Metres<double>> heights(altitudes.size());
+  for (int i{0}; i < 2; ++i)
+    to_metres(std::span<const Feet<double>>(altitudes),
+              std::span<Metres<double>>(heights));
+  BOOST_CHECK_EQUAL(Metres<double>(304.8), heights.front());
+
+  const auto records{trace::snapshot()};
+  if constexpr (!trace::ENABLED) {
+    BOOST_CHECK(records.empty());
+    return;
+  }
+
+  BOOST_REQUIRE_EQUAL(2u, records.size());
+  const auto *const converted{
+      find_record(records, "convert", "Feet<float> -> Metres<double>")};
+  BOOST_REQUIRE(converted);
+  BOOST_CHECK_EQUAL(1u, converted->calls);
+  BOOST_CHECK_EQUAL(1'000u, converted->elements);
+  // a batch of fewer than 4096 elements
+  BOOST_CHECK_EQUAL(1u, converted->batch_sizes[2]);
+
+  const auto *const to_metres_record{
+      find_record(records, "to_metres", "Feet<double> -> Metres<double>")};
+  BOOST_REQUIRE(to_metres_record);
+  BOOST_CHECK_EQUAL(2u, to_metres_record->calls);
+  BOOST_CHECK_EQUAL(20u, to_metres_record->elements);
+  // batches of fewer than 16 elements
+  BOOST_CHECK_EQUAL(2u, to_metres_record->batch_sizes[0]);
+
+  // reset sets the counts to zero
+  trace::reset();
+  BOOST_CHECK(trace::snapshot().empty());
+}
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+BOOST_AUTO_TEST_CASE(test_snapshot_threads) {
+  trace::reset();
+
+  // The counts of the threads of a pool are included, with a call per chunk.
+  constexpr std::size_t SIZE{100'000};
+  const std::vector<NauticalMiles<double>> distances(SIZE,
+                                                     NauticalMiles<double>(1));
+  std::vector<Metres<double>> metres(SIZE);
+  ThreadPool pool(4);
+  const Parallel policy{.threshold = 1'000, .pool = &pool};
+  to_metres(policy, std::span<const NauticalMiles<double>>(distances),
+            std::span<Metres<double>>(metres));
+
+  // The counts of a thread that has exited are kept.
+  std::thread thread([] {
+    const std::vector<Metres<float>> in(200, Metres<float>(1'852));
+    std::vector<NauticalMiles<float>> out(in.size());
+    to_nautical_miles(std::span<const Metres<float>>(in),
+                      std::span<NauticalMiles<float>>(out));
+  });
+  thread.join();
+
+  const auto records{trace::snapshot()};
+  if constexpr (!trace::ENABLED) {
+    BOOST_CHECK(records.empty());
+    return;
+  }
+
+  const auto *const parallel{find_record(
+      records, "to_metres", "NauticalMiles<double> -> Metres<double>")};
+  BOOST_REQUIRE(parallel);
+  BOOST_CHECK_EQUAL(detail::chunks<double>(policy, SIZE).count,
+                    parallel->calls);
+  BOOST_CHECK_EQUAL(SIZE, parallel->elements);
+
+  const auto *const exited{find_record(
+      records, "to_nautical_miles", "Metres<float> -> NauticalMiles<float>")};
+  BOOST_REQUIRE(exited);
+  BOOST_CHECK_EQUAL(1u, exited->calls);
+  BOOST_CHECK_EQUAL(200u, exited->elements);
+  BOOST_CHECK_EQUAL(1u, exited->batch_sizes[1]);
+}
+//////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_SUITE_END()
+//////////////////////////////////////////////////////////////////////////////